@@ -2,28 +2,38 @@
 #define _ARVORE_BINARIA_AVL_H
 
 #include <stdbool.h>
-
-// Definição de um valor para indicar erro em operações
-#define ERRO -32000
+#include "Alocador.h"
 
 // Definição da estrutura da árvore AVL (a estrutura é definida aqui de forma abstrata)
 typedef struct avl AVL;
 
-// Protótipos das funções para manipulação da árvore AVL
+// Iterador em ordem crescente sobre as chaves de uma árvore AVL
+typedef struct avl_iterador AVL_ITERADOR;
+
+// Protótipos das funções para manipulação da árvore AVL com chaves int
+// (geradas a partir de AVL_modelo.h; outros tipos de chave estão em Chaves.h)
 
 // Cria e inicializa uma árvore AVL vazia
 AVL *avl_criar(void);
 
+// Cria uma árvore AVL vazia cujos nós e cabeçalho vêm de 'mem' (veja Alocador.h)
+AVL *avl_criar_com_alocador(ALOCADOR *mem);
+
+// Retorna o alocador usado pela árvore
+ALOCADOR *avl_alocador(AVL *T);
+
 // Libera toda a memória usada pela árvore AVL
 void avl_apagar(AVL **T);
 
 // Insere uma chave (número inteiro) na árvore AVL, balanceando a árvore
+// (retorna false, sem alterar a árvore, se a chave já existir)
 bool avl_inserir(AVL *T, int chave);
 
 // Busca uma chave na árvore AVL
 bool avl_busca(AVL *T, int chave);
 
 // Remove uma chave da árvore AVL, ajustando o balanceamento da árvore
+// (retorna false, sem alterar a árvore, se a chave não existir)
 bool avl_remover(AVL *T, int chave);
 
 // Imprime a árvore AVL (usada para depuração)
@@ -32,13 +42,56 @@ void avl_imprimir(AVL *T);
 // Verifica se a árvore AVL está vazia
 bool avl_vazia(AVL *T);
 
-// Cria uma cópia (clone) da árvore AVL
+// Cria uma cópia (clone) da árvore AVL em O(1); os nós são compartilhados
+// e copiados sob demanda quando uma das árvores for alterada
 AVL *avl_clonar(AVL *A);
 
 // Faz a união de duas árvores AVL, combinando todos os elementos
+// (o resultado compartilha com A as subárvores que não mudaram)
 AVL *avl_uniao(AVL *A, AVL *B);
 
 // Faz a interseção de duas árvores AVL, mantendo apenas os elementos em comum
+// (o resultado compartilha com A as subárvores que não mudaram)
 AVL *avl_interseccao(AVL *A, AVL *B);
 
+// União e interseção dentro de A em O(n + m), sem criar outra árvore; os nós que saem
+// são liberados de uma vez. As versões "_consumindo" reaproveitam os nós de B em vez de
+// alocar novos e apagam B (*B vira NULL). Retornam false se faltar memória
+bool avl_uniao_em(AVL *A, AVL *B);
+bool avl_interseccao_em(AVL *A, AVL *B);
+bool avl_uniao_em_consumindo(AVL *A, AVL **B);
+bool avl_interseccao_em_consumindo(AVL *A, AVL **B);
+
+// Verifica as invariantes da árvore (ordem, alturas armazenadas e balanceamento);
+// preenche a quantidade de chaves e a profundidade real e retorna o número de violações
+int avl_auditar(AVL *T, int *elementos, int *profundidade);
+
+// Reconstrói a árvore com balanceamento perfeito em O(n); retorna false se faltar memória
+bool avl_rebalancear(AVL *T);
+
+// Substitui o conteúdo da árvore pelas 'n' chaves em ordem estritamente crescente, em O(n)
+// (carga em bloco); retorna false, sem alterar a árvore, se a ordem não for respeitada
+bool avl_carregar_ordenadas(AVL *T, const int *chaves, int n);
+
+// Menor e maior chave em O(1) (guardadas na árvore); retornam false se ela estiver vazia
+bool avl_minimo(AVL *T, int *chave);
+bool avl_maximo(AVL *T, int *chave);
+
+// Vizinhos de 'chave' em O(log n), que não precisa estar na árvore: sucessor (menor chave
+// maior), antecessor (maior chave menor), piso (maior chave <= chave) e teto (menor chave
+// >= chave). Retornam false se o vizinho não existir
+bool avl_sucessor(AVL *T, int chave, int *resultado);
+bool avl_antecessor(AVL *T, int chave, int *resultado);
+bool avl_piso(AVL *T, int chave, int *resultado);
+bool avl_teto(AVL *T, int chave, int *resultado);
+
+// Cria um iterador em ordem sobre a árvore (a árvore não pode ser alterada enquanto ele existir)
+AVL_ITERADOR *avl_iterador_criar(AVL *T);
+
+// Avança o iterador; retorna false quando não há mais chaves
+bool avl_iterador_proximo(AVL_ITERADOR *it, int *chave);
+
+// Libera o iterador
+void avl_iterador_apagar(AVL_ITERADOR **it);
+
 #endif
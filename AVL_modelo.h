@@ -0,0 +1,988 @@
+// Modelo (template) da árvore AVL, instanciado por macros para cada tipo de chave.
+// Cada instância tem seu próprio layout de nó e sua comparação expandida em linha,
+// sem ponteiros genéricos nem chamadas indiretas nas comparações.
+//
+// Parâmetros (definidos antes de incluir este arquivo, que os apaga no final):
+//   AVL_CHAVE                tipo da chave (ex.: int, int64_t, uma struct pequena)
+//   AVL_PREFIXO              prefixo das funções e da struct da árvore (ex.: avl -> avl_inserir)
+//   AVL_TIPO                 nome do tipo da árvore (ex.: AVL)
+//   AVL_ITERADOR_TIPO        nome do tipo do iterador (ex.: AVL_ITERADOR)
+//   AVL_COMPARAR(a, b)       opcional: negativo, zero ou positivo; padrão usa < e >
+//   AVL_IMPRIMIR_CHAVE(c)    imprime uma chave seguida de espaço
+//   AVL_MODELO_SEM_DECLARACOES  não gera os tipos e protótipos (já declarados em outro cabeçalho)
+//   AVL_MODELO_IMPLEMENTAR      gera as definições das funções (em um único .c por instância)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "Alocador.h"
+
+#if !defined(AVL_CHAVE) || !defined(AVL_PREFIXO) || !defined(AVL_TIPO) || !defined(AVL_ITERADOR_TIPO)
+#error "Defina AVL_CHAVE, AVL_PREFIXO, AVL_TIPO e AVL_ITERADOR_TIPO antes de incluir AVL_modelo.h"
+#endif
+
+#ifndef AVL_COMPARAR
+#define AVL_COMPARAR(a, b) (((a) > (b)) - ((a) < (b)))
+#endif
+
+#define AVL_CONCATENAR_(a, b) a##_##b
+#define AVL_CONCATENAR(a, b) AVL_CONCATENAR_(a, b)
+#define AVL_F(nome) AVL_CONCATENAR(AVL_PREFIXO, nome) // Nome da função nesta instância
+#define AVL_MENOR(a, b) (AVL_COMPARAR(a, b) < 0)
+#define AVL_IGUAL(a, b) (AVL_COMPARAR(a, b) == 0)
+
+#ifndef AVL_MODELO_SEM_DECLARACOES
+
+// Definição da estrutura da árvore AVL (a estrutura é definida aqui de forma abstrata)
+typedef struct AVL_PREFIXO AVL_TIPO;
+
+// Iterador em ordem crescente sobre as chaves de uma árvore AVL
+typedef struct AVL_F(iterador) AVL_ITERADOR_TIPO;
+
+// Cria e inicializa uma árvore AVL vazia
+AVL_TIPO *AVL_F(criar)(void);
+
+// Cria uma árvore AVL vazia cujos nós e cabeçalho vêm de 'mem' (que ela retém); clones e
+// resultados de operações herdam o alocador de quem lhes dá os nós
+AVL_TIPO *AVL_F(criar_com_alocador)(ALOCADOR *mem);
+
+// Alocador usado pela árvore
+ALOCADOR *AVL_F(alocador)(AVL_TIPO *T);
+
+// Libera toda a memória usada pela árvore AVL
+void AVL_F(apagar)(AVL_TIPO **T);
+
+// Insere uma chave na árvore AVL, balanceando a árvore
+bool AVL_F(inserir)(AVL_TIPO *T, AVL_CHAVE chave);
+
+// Busca uma chave na árvore AVL
+bool AVL_F(busca)(AVL_TIPO *T, AVL_CHAVE chave);
+
+// Remove uma chave da árvore AVL, ajustando o balanceamento da árvore
+bool AVL_F(remover)(AVL_TIPO *T, AVL_CHAVE chave);
+
+// Imprime a árvore AVL (usada para depuração)
+void AVL_F(imprimir)(AVL_TIPO *T);
+
+// Verifica se a árvore AVL está vazia
+bool AVL_F(vazia)(AVL_TIPO *T);
+
+// Cria uma cópia (clone) da árvore AVL em O(1); os nós são compartilhados
+// e copiados sob demanda quando uma das árvores for alterada
+AVL_TIPO *AVL_F(clonar)(AVL_TIPO *A);
+
+// Faz a união de duas árvores AVL (compartilha com A as subárvores que não mudaram)
+AVL_TIPO *AVL_F(uniao)(AVL_TIPO *A, AVL_TIPO *B);
+
+// Faz a interseção de duas árvores AVL (compartilha com A as subárvores que não mudaram)
+AVL_TIPO *AVL_F(interseccao)(AVL_TIPO *A, AVL_TIPO *B);
+
+// União e interseção dentro de A em O(n + m): A passa a conter o resultado, sem criar outra
+// árvore, e os nós descartados são liberados de uma vez. Nas versões que consomem B, os nós
+// de B são reaproveitados em A (sem alocar) se os alocadores forem compatíveis (veja
+// alocador_compativel), e B é apagada (*B vira NULL; B deve ser diferente de A). Retornam
+// false se faltar memória, sem alterar o conteúdo de A
+bool AVL_F(uniao_em)(AVL_TIPO *A, AVL_TIPO *B);
+bool AVL_F(interseccao_em)(AVL_TIPO *A, AVL_TIPO *B);
+bool AVL_F(uniao_em_consumindo)(AVL_TIPO *A, AVL_TIPO **B);
+bool AVL_F(interseccao_em_consumindo)(AVL_TIPO *A, AVL_TIPO **B);
+
+// Verifica as invariantes da árvore (ordem das chaves, alturas armazenadas e fator de
+// balanceamento entre -1 e 1); preenche a quantidade de chaves e a profundidade real
+// e retorna o número de violações encontradas
+int AVL_F(auditar)(AVL_TIPO *T, int *elementos, int *profundidade);
+
+// Reconstrói a árvore com balanceamento perfeito em O(n), remontando os próprios nós sem
+// alocar; só os nós que ela divide com clones são copiados antes. Retorna false (sem
+// alterar as chaves da árvore) se faltar memória para essas cópias
+bool AVL_F(rebalancear)(AVL_TIPO *T);
+
+// Substitui o conteúdo da árvore pelas 'n' chaves de 'chaves', que devem estar em ordem
+// estritamente crescente, montando a árvore balanceada em O(n) (carga em bloco).
+// Retorna false (sem alterar a árvore) se a ordem não for respeitada ou faltar memória
+bool AVL_F(carregar_ordenadas)(AVL_TIPO *T, const AVL_CHAVE *chaves, int n);
+
+// Menor e maior chave em O(1) (guardadas na árvore); retornam false se ela estiver vazia
+bool AVL_F(minimo)(AVL_TIPO *T, AVL_CHAVE *chave);
+bool AVL_F(maximo)(AVL_TIPO *T, AVL_CHAVE *chave);
+
+// Vizinhos de 'chave' em O(log n), que não precisa estar na árvore: menor chave > chave
+// (sucessor), maior chave < chave (antecessor), maior chave <= chave (piso) e menor
+// chave >= chave (teto). Preenchem '*resultado' e retornam false se ele não existir
+bool AVL_F(sucessor)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado);
+bool AVL_F(antecessor)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado);
+bool AVL_F(piso)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado);
+bool AVL_F(teto)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado);
+
+// Cria um iterador em ordem sobre a árvore (a árvore não pode ser alterada enquanto ele existir)
+AVL_ITERADOR_TIPO *AVL_F(iterador_criar)(AVL_TIPO *T);
+
+// Avança o iterador; retorna false quando não há mais chaves
+bool AVL_F(iterador_proximo)(AVL_ITERADOR_TIPO *it, AVL_CHAVE *chave);
+
+// Libera o iterador
+void AVL_F(iterador_apagar)(AVL_ITERADOR_TIPO **it);
+
+#endif // AVL_MODELO_SEM_DECLARACOES
+
+#ifdef AVL_MODELO_IMPLEMENTAR
+
+#ifndef AVL_IMPRIMIR_CHAVE
+#error "Defina AVL_IMPRIMIR_CHAVE para implementar uma instância de AVL_modelo.h"
+#endif
+
+#define AVL_NO struct AVL_F(no)
+
+// Estrutura do nó da AVL
+struct AVL_F(no) {
+    AVL_CHAVE chave;  // Chave do nó
+    AVL_NO *esq;    // Filho esquerdo
+    AVL_NO *dir;    // Filho direito
+    int FB;     // Fator de balanceamento
+    int altura; // Altura do nó
+    int ref;    // Quantidade de referências (pais ou raízes de árvores) que compartilham o nó
+};
+
+// Estrutura da árvore AVL
+struct AVL_PREFIXO {
+    AVL_NO *raiz;          // Raiz da árvore
+    int profundidade;  // Profundidade máxima
+    AVL_CHAVE minimo;      // Menor chave (válida se a raiz não for NULL); são guardados valores e não
+    AVL_CHAVE maximo;      // nós, pois os nós das pontas mudam quando um caminho compartilhado é copiado
+    ALOCADOR *mem;         // Origem dos nós e do cabeçalho, compartilhada com os clones
+};
+
+//! Cria uma árvore AVL vazia com nós alocados por 'mem'
+AVL_TIPO *AVL_F(criar_com_alocador)(ALOCADOR *mem) {
+    if (mem == NULL) return NULL;
+    AVL_TIPO *T = (AVL_TIPO *)alocador_alocar(mem, sizeof(AVL_TIPO)); // Aloca memória para a árvore
+    if (T == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");  // Se a alocação falhar, imprime um erro
+        return NULL;
+    }
+    T->raiz = NULL;          // Inicializa a raiz como NULL (a árvore começa vazia)
+    T->profundidade = -1;    // Profundidade inicial é -1, pois não há nós
+    T->mem = alocador_reter(mem);
+    return T;                // Retorna o ponteiro para a árvore criada
+}
+
+//! Cria uma árvore AVL vazia, com malloc e free
+AVL_TIPO *AVL_F(criar)(void) {
+    ALOCADOR *mem = alocador_criar(NULL);
+    AVL_TIPO *T = AVL_F(criar_com_alocador)(mem);
+    alocador_soltar(&mem); // A árvore ficou com a única referência
+    return T;
+}
+
+//! Alocador usado pela árvore
+ALOCADOR *AVL_F(alocador)(AVL_TIPO *T) {
+    return T ? T->mem : NULL;
+}
+
+// Cria um nó com a chave fornecida
+static AVL_NO *AVL_F(criar_no)(ALOCADOR *mem, AVL_CHAVE chave) {
+    AVL_NO *no = (AVL_NO *)alocador_alocar(mem, sizeof(AVL_NO)); // Aloca memória para o nó
+    if (no) {
+        no->chave = chave;             // Define a chave do nó
+        no->esq = no->dir = NULL;      // Inicializa os filhos (esquerda e direita) como NULL
+        no->FB = 0;                    // Inicializa o fator de balanceamento como 0
+        no->altura = 1;                // Uma folha tem altura 1 (a subárvore vazia tem altura 0)
+        no->ref = 1;                   // O nó começa referenciado apenas por quem o criou
+    }
+    return no;  // Retorna o ponteiro para o nó criado
+}
+
+// Função recursiva para apagar todos os nós
+static void AVL_F(apagar_aux)(ALOCADOR *mem, AVL_NO **raiz) {
+    if (*raiz) {
+        // Nós compartilhados com outras árvores só perdem esta referência
+        if (--(*raiz)->ref == 0) {
+            AVL_F(apagar_aux)(mem, &(*raiz)->esq); // Apaga a subárvore esquerda
+            AVL_F(apagar_aux)(mem, &(*raiz)->dir); // Apaga a subárvore direita
+            alocador_liberar(mem, *raiz, sizeof(AVL_NO)); // Libera a memória do nó atual
+        }
+        *raiz = NULL;                  // Define o ponteiro para NULL para evitar referências pendentes
+    }
+}
+
+// Retorna uma versão do nó que pode ser alterada sem afetar outras árvores.
+// Se o nó for compartilhado, cria uma cópia que passa a compartilhar os filhos;
+// o resultado deve substituir o nó no mesmo ponteiro de onde ele foi lido. Retorna NULL
+// se faltar memória para a cópia (o nó não muda); por isso quem altera uma árvore
+// compartilhada reserva antes os nós que pode precisar copiar (veja AVL_F(reservar))
+static AVL_NO *AVL_F(exclusivo)(ALOCADOR *mem, AVL_NO *no) {
+    if (no == NULL || no->ref == 1) return no;
+
+    AVL_NO *copia = AVL_F(criar_no)(mem, no->chave);
+    if (copia == NULL) return NULL;
+    copia->esq = no->esq;
+    copia->dir = no->dir;
+    copia->FB = no->FB;
+    copia->altura = no->altura;
+    if (copia->esq) copia->esq->ref++; // Os filhos ganham mais um pai
+    if (copia->dir) copia->dir->ref++;
+    no->ref--;                          // O original perde a referência que foi para a cópia
+    return copia;
+}
+
+// Garante memória para copiar até 'n' nós compartilhados durante uma alteração, que assim
+// não falha pela metade. Uma árvore que não divide o alocador com nenhuma outra não tem nós
+// compartilhados e não reserva nada
+static bool AVL_F(reservar)(AVL_TIPO *T, int n) {
+    return !alocador_compartilhado(T->mem) || alocador_reservar(T->mem, n, sizeof(AVL_NO));
+}
+
+// Copia todos os nós compartilhados da subárvore, para que ela possa ser desmontada sem
+// alocar. Se faltar memória retorna false; os nós já copiados são iguais aos originais,
+// então a árvore continua a mesma
+static bool AVL_F(tornar_exclusiva)(ALOCADOR *mem, AVL_NO **raiz) {
+    if (*raiz == NULL) return true;
+
+    AVL_NO *no = AVL_F(exclusivo)(mem, *raiz);
+    if (no == NULL) return false;
+    *raiz = no;
+    return AVL_F(tornar_exclusiva)(mem, &no->esq) && AVL_F(tornar_exclusiva)(mem, &no->dir);
+}
+
+//! Apaga a árvore AVL e libera a memória
+void AVL_F(apagar)(AVL_TIPO **T) {
+    if (T && *T) {
+        ALOCADOR *mem = (*T)->mem;
+        AVL_F(apagar_aux)(mem, &(*T)->raiz);  // Apaga todos os nós da árvore
+        alocador_liberar(mem, *T, sizeof(AVL_TIPO)); // Libera a memória alocada para a estrutura da árvore
+        alocador_soltar(&mem);
+        *T = NULL;                    // Define o ponteiro da árvore como NULL para evitar referências pendentes
+    }
+}
+
+// Função para obter a altura de um nó
+static int AVL_F(altura_no)(AVL_NO *no) {
+    // Se o nó não for NULL, retorna a altura armazenada no nó; caso contrário, retorna 0
+    return no ? no->altura : 0;
+}
+
+// Função para calcular o fator de balanceamento
+static int AVL_F(fator_balanceamento)(AVL_NO *raiz) {
+    // Calcula o fator de balanceamento, que é a diferença entre as alturas das subárvores esquerda e direita
+    // Se o nó for NULL, retorna 0
+    return raiz ? AVL_F(altura_no)(raiz->esq) - AVL_F(altura_no)(raiz->dir) : 0;
+}
+
+// Recalcula a altura e o fator de balanceamento de um nó a partir das alturas dos filhos
+static void AVL_F(atualizar_altura)(AVL_NO *no) {
+    int esq = AVL_F(altura_no)(no->esq), dir = AVL_F(altura_no)(no->dir);
+    no->altura = 1 + (esq > dir ? esq : dir);
+    no->FB = esq - dir;
+}
+
+// Realiza rotação simples à direita para balancear a árvore
+static AVL_NO *AVL_F(rodar_dir)(ALOCADOR *mem, AVL_NO *a) {
+    // Os nós alterados pela rotação não podem ser compartilhados
+    a = AVL_F(exclusivo)(mem, a);
+    a->esq = AVL_F(exclusivo)(mem, a->esq);
+
+    // 'b' será o novo nó raiz da subárvore
+    AVL_NO *b = a->esq;
+
+    // Realiza a rotação à direita
+    a->esq = b->dir; // A subárvore direita de 'b' passa a ser a subárvore esquerda de 'a'
+    b->dir = a;      // 'a' se torna a subárvore direita de 'b'
+
+    // Atualiza as alturas dos nós ('a' agora é filho de 'b')
+    AVL_F(atualizar_altura)(a);
+    AVL_F(atualizar_altura)(b);
+
+    return b; // Retorna o novo nó raiz, que é 'b'
+}
+
+// Realiza rotação simples à esquerda para balancear a árvore
+static AVL_NO *AVL_F(rodar_esq)(ALOCADOR *mem, AVL_NO *a) {
+    // Os nós alterados pela rotação não podem ser compartilhados
+    a = AVL_F(exclusivo)(mem, a);
+    a->dir = AVL_F(exclusivo)(mem, a->dir);
+
+    // 'b' será o novo nó raiz da subárvore
+    AVL_NO *b = a->dir;
+
+    // Realiza a rotação à esquerda
+    a->dir = b->esq; // A subárvore esquerda de 'b' passa a ser a subárvore direita de 'a'
+    b->esq = a;      // 'a' se torna a subárvore esquerda de 'b'
+
+    // Atualiza as alturas dos nós ('a' agora é filho de 'b')
+    AVL_F(atualizar_altura)(a);
+    AVL_F(atualizar_altura)(b);
+
+    return b; // Retorna o novo nó raiz, que é 'b'
+}
+
+// Realiza rotação dupla: esquerda-direita, necessário para balancear a árvore em alguns casos
+static AVL_NO *AVL_F(rodar_esquerda_direita)(ALOCADOR *mem, AVL_NO *a) {
+    // Realiza uma rotação à esquerda na subárvore esquerda de 'a'
+    a->esq = AVL_F(rodar_esq)(mem, a->esq);
+    
+    // Após a rotação à esquerda, realiza a rotação à direita
+    return AVL_F(rodar_dir)(mem, a); 
+}
+
+// Realiza rotação dupla: direita-esquerda, necessário para balancear a árvore em alguns casos
+static AVL_NO *AVL_F(rodar_direita_esquerda)(ALOCADOR *mem, AVL_NO *a) {
+    // Realiza uma rotação à direita na subárvore direita de 'a'
+    a->dir = AVL_F(rodar_dir)(mem, a->dir);
+    
+    // Após a rotação à direita, realiza a rotação à esquerda
+    return AVL_F(rodar_esq)(mem, a);
+}
+
+// Balanceia a árvore AVL após a inserção ou remoção de um nó
+static AVL_NO *AVL_F(balancear)(ALOCADOR *mem, AVL_NO *raiz) {
+    AVL_F(atualizar_altura)(raiz); // Os filhos já estão atualizados; a altura do nó muda junto com eles
+
+    int FB = AVL_F(fator_balanceamento)(raiz);  // Calcula o fator de balanceamento da árvore
+
+    // Se o fator de balanceamento for -2, a árvore está desbalanceada para a direita
+    if (FB == -2) {
+        if (AVL_F(fator_balanceamento)(raiz->dir) <= 0)
+            raiz = AVL_F(rodar_esq)(mem, raiz); // Realiza uma rotação simples à esquerda
+        else
+            raiz = AVL_F(rodar_direita_esquerda)(mem, raiz); // Realiza uma rotação direita-esquerda (dupla)
+    } 
+    // Se o fator de balanceamento for 2, a árvore está desbalanceada para a esquerda
+    else if (FB == 2) {
+        if (AVL_F(fator_balanceamento)(raiz->esq) >= 0)
+            raiz = AVL_F(rodar_dir)(mem, raiz); // Realiza uma rotação simples à direita
+        else
+            raiz = AVL_F(rodar_esquerda_direita)(mem, raiz); // Realiza uma rotação esquerda-direita (dupla)
+    }
+
+    return raiz; // Retorna a árvore balanceada
+}
+
+// Função recursiva auxiliar que insere o nó 'novo' na árvore AVL. As rotações só envolvem
+// nós do caminho, que já foram copiados na descida
+static AVL_NO *AVL_F(inserir_no)(ALOCADOR *mem, AVL_NO *raiz, AVL_NO *novo) {
+    // Se a árvore estiver vazia, o novo nó é a raiz
+    if (raiz == NULL) return novo;
+
+    raiz = AVL_F(exclusivo)(mem, raiz); // Copia o nó se ele for compartilhado com outra árvore
+    if (AVL_MENOR(novo->chave, raiz->chave)) {
+        raiz->esq = AVL_F(inserir_no)(mem, raiz->esq, novo); // Insere a chave na subárvore esquerda
+    } else if (AVL_MENOR(raiz->chave, novo->chave)) {
+        raiz->dir = AVL_F(inserir_no)(mem, raiz->dir, novo); // Insere a chave na subárvore direita
+    }
+
+    // Após a inserção, balanceia a árvore
+    raiz = AVL_F(balancear)(mem, raiz);
+
+    return raiz; // Retorna a raiz da árvore balanceada
+}
+
+// Recalcula a menor e a maior chave descendo pelas pontas da árvore
+static void AVL_F(atualizar_extremos)(AVL_TIPO *T) {
+    AVL_NO *no = T->raiz;
+    if (no == NULL) return;
+    while (no->esq != NULL) no = no->esq;
+    T->minimo = no->chave;
+    no = T->raiz;
+    while (no->dir != NULL) no = no->dir;
+    T->maximo = no->chave;
+}
+
+//! Função pública para inserir uma chave na árvore AVL
+bool AVL_F(inserir)(AVL_TIPO *T, AVL_CHAVE chave) {
+    if (T == NULL) return false; // Verifica se a árvore AVL é válida antes de tentar inserir
+
+    // Busca só de leitura primeiro: uma chave repetida não aloca, não copia nós
+    // compartilhados e não rebalanceia nada
+    if (AVL_F(busca)(T, chave)) return false;
+
+    // Toda a memória vem antes de alterar a árvore: o novo nó e, se houver nós compartilhados,
+    // as cópias do caminho (no máximo um nó por nível)
+    if (!AVL_F(reservar)(T, AVL_F(altura_no)(T->raiz) + 2)) return false;
+    AVL_NO *novo = AVL_F(criar_no)(T->mem, chave);
+    if (novo == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+
+    if (T->raiz == NULL || AVL_MENOR(chave, T->minimo)) T->minimo = chave; // A nova chave pode ser
+    if (T->raiz == NULL || AVL_MENOR(T->maximo, chave)) T->maximo = chave; // uma das pontas
+    T->raiz = AVL_F(inserir_no)(T->mem, T->raiz, novo);  // Chama a função auxiliar para realizar a inserção
+    return true; // Retorna verdadeiro indicando que a inserção foi bem-sucedida
+}
+
+
+// Função auxiliar recursiva para remover um nó na árvore AVL
+static AVL_NO *AVL_F(remover_aux)(ALOCADOR *mem, AVL_NO **raiz, AVL_CHAVE chave, bool *removido) {
+    AVL_NO *temp;
+
+    if (*raiz == NULL) return NULL; // Se a árvore estiver vazia, a chave não foi encontrada
+
+    *raiz = AVL_F(exclusivo)(mem, *raiz); // Copia o nó se ele for compartilhado com outra árvore
+
+    // Verifica se a chave é igual à chave do nó atual
+    if (AVL_IGUAL(chave, (*raiz)->chave)) {
+        *removido = true; // Marca que o nó foi encontrado e será removido
+
+        // Caso 1 e 2: O nó possui 0 ou 1 filho
+        if ((*raiz)->esq == NULL || (*raiz)->dir == NULL) {
+            temp = *raiz;
+            if ((*raiz)->esq == NULL)
+                *raiz = (*raiz)->dir; // Atualiza o nó com o filho direito (ou NULL)
+            else
+                *raiz = (*raiz)->esq; // Atualiza o nó com o filho esquerdo (ou NULL)
+
+            alocador_liberar(mem, temp, sizeof(AVL_NO)); // Libera o nó
+            temp = NULL;
+        } 
+        // Caso 3: O nó possui dois filhos. Ele recebe a maior chave da subárvore esquerda,
+        // que é removida de lá pelo mesmo caminho recursivo, rebalanceando cada ancestral
+        else {
+            AVL_NO *maior = (*raiz)->esq;
+            while (maior->dir != NULL) maior = maior->dir;
+            (*raiz)->chave = maior->chave;
+
+            bool removido_maior = false;
+            (*raiz)->esq = AVL_F(remover_aux)(mem, &(*raiz)->esq, (*raiz)->chave, &removido_maior);
+        }
+    } 
+    // Caso de busca na subárvore esquerda
+    else if (AVL_MENOR(chave, (*raiz)->chave)) 
+        (*raiz)->esq = AVL_F(remover_aux)(mem, &(*raiz)->esq, chave, removido);
+
+    // Caso de busca na subárvore direita
+    else if (AVL_MENOR((*raiz)->chave, chave))
+        (*raiz)->dir = AVL_F(remover_aux)(mem, &(*raiz)->dir, chave, removido);
+
+    // Após a remoção, a árvore precisa ser rebalanceada
+    if (*raiz != NULL) 
+        *raiz = AVL_F(balancear)(mem, *raiz); // Chama a função de balanceamento
+
+    return *raiz;
+}
+
+//! Função pública para remover uma chave da árvore AVL
+bool AVL_F(remover)(AVL_TIPO *T, AVL_CHAVE chave) {
+    if (T == NULL) return false; // Se a árvore for vazia, retorna falso
+
+    // Busca só de leitura primeiro: remover uma chave ausente não altera a árvore
+    if (!AVL_F(busca)(T, chave)) return false;
+
+    // Cópias possíveis por nível: o nó do caminho e, numa rotação, o irmão e um filho dele
+    if (!AVL_F(reservar)(T, 3 * (AVL_F(altura_no)(T->raiz) + 1))) return false;
+
+    bool removido = false;
+    T->raiz = AVL_F(remover_aux)(T->mem, &T->raiz, chave, &removido); // Chama a função auxiliar para remover o nó
+    if (AVL_IGUAL(chave, T->minimo) || AVL_IGUAL(chave, T->maximo)) {
+        AVL_F(atualizar_extremos)(T); // Saiu uma das pontas: desce até a nova em O(log n)
+    }
+    return removido; // Retorna se a remoção foi realizada com sucesso
+}
+
+// Função auxiliar recursiva para buscar um nó na árvore AVL
+static bool AVL_F(busca_aux)(AVL_NO *raiz, AVL_CHAVE chave) {
+    if (raiz == NULL) {
+        return false; // Se a subárvore for vazia, a chave não foi encontrada
+    }
+    if (AVL_IGUAL(chave, raiz->chave)) {
+        return true; // Se a chave for igual à do nó atual, a chave foi encontrada
+    }
+    if (AVL_MENOR(chave, raiz->chave)) {
+        return AVL_F(busca_aux)(raiz->esq, chave); // Se a chave for menor, busca na subárvore esquerda
+    } else {
+        return AVL_F(busca_aux)(raiz->dir, chave); // Se a chave for maior, busca na subárvore direita
+    }
+}
+
+//! Função pública para buscar um nó pela chave na árvore AVL
+bool AVL_F(busca)(AVL_TIPO *T, AVL_CHAVE chave) {
+    if (T == NULL || T->raiz == NULL) {
+        return false; // Se a árvore for vazia ou inexistente, retorna falso
+    }
+    return AVL_F(busca_aux)(T->raiz, chave); // Chama a função auxiliar para realizar a busca
+}
+
+// Imprime os nós em pré-ordem (raiz, esquerda, direita)
+static void AVL_F(imprimir_preordem)(AVL_NO *raiz) {
+    if (raiz != NULL) {
+        AVL_IMPRIMIR_CHAVE(raiz->chave);  // Imprime a chave do nó atual
+        AVL_F(imprimir_preordem)(raiz->esq); // Chama a função recursivamente para a subárvore esquerda
+        AVL_F(imprimir_preordem)(raiz->dir); // Chama a função recursivamente para a subárvore direita
+    }
+}
+
+//! Função pública para imprimir a árvore AVL em pré-ordem
+void AVL_F(imprimir)(AVL_TIPO *T) {
+    if (T != NULL && T->raiz != NULL) {  // Verifica se a árvore não está vazia
+        AVL_F(imprimir_preordem)(T->raiz);      // Chama a função auxiliar de impressão
+    } else {
+        printf("Arvore vazia.\n"); // Se a árvore estiver vazia, imprime uma mensagem
+    }
+}
+
+// Verifica se a árvore AVL está vazia
+bool AVL_F(vazia)(AVL_TIPO *T) {
+    return T == NULL || T->raiz == NULL; // Retorna verdadeiro se a árvore for nula ou a raiz for nula
+}
+
+// Função auxiliar para clonar elementos de uma árvore AVL
+static void AVL_F(clonar_elementos)(AVL_NO *raiz, AVL_TIPO *destino) {
+    if (raiz != NULL) {
+        AVL_F(inserir)(destino, raiz->chave); // Insere o valor da raiz na árvore destino
+        AVL_F(clonar_elementos)(raiz->esq, destino); // Clona a subárvore esquerda
+        AVL_F(clonar_elementos)(raiz->dir, destino); // Clona a subárvore direita
+    }
+}
+
+//! Função principal para clonar uma árvore AVL em O(1): o clone compartilha todos os nós de A
+AVL_TIPO *AVL_F(clonar)(AVL_TIPO *A) {
+    if (A == NULL) return AVL_F(criar)(); // Retorna árvore vazia se A for nula
+    AVL_TIPO *clone = AVL_F(criar_com_alocador)(A->mem); // Os nós compartilhados vêm do mesmo alocador
+    if (clone == NULL) return NULL;
+
+    clone->raiz = A->raiz;              // Compartilha a raiz; alterações futuras copiam o caminho
+    if (clone->raiz) clone->raiz->ref++;
+    clone->profundidade = A->profundidade;
+    clone->minimo = A->minimo;
+    clone->maximo = A->maximo;
+    return clone; // Retorna o clone da árvore
+}
+
+//! Função para realizar a união de duas árvores AVL
+AVL_TIPO *AVL_F(uniao)(AVL_TIPO *A, AVL_TIPO *B) {
+    if (A == NULL || A->raiz == NULL) return AVL_F(clonar)(B); // Se A for nula, clona B
+    if (B == NULL || B->raiz == NULL) return AVL_F(clonar)(A); // Se B for nula, clona A
+
+    AVL_TIPO *uniao = AVL_F(clonar)(A); // Parte de A; as subárvores não tocadas por B continuam compartilhadas
+    if (uniao == NULL) return NULL;
+    AVL_F(clonar_elementos)(B->raiz, uniao); // Clona elementos de B para a árvore de união
+
+    return uniao; // Retorna a árvore resultante da união
+}
+
+// Função auxiliar que remove do resultado os elementos de A que não estão em B
+static void AVL_F(remover_ausentes)(AVL_NO *raiz, AVL_TIPO *B, AVL_TIPO *resultado) {
+    if (raiz != NULL) {
+        if (!AVL_F(busca)(B, raiz->chave)) { // Verifica se o elemento está fora de B
+            AVL_F(remover)(resultado, raiz->chave); // Retira do resultado se não houver interseção
+        }
+        AVL_F(remover_ausentes)(raiz->esq, B, resultado); // Verifica subárvore esquerda
+        AVL_F(remover_ausentes)(raiz->dir, B, resultado); // Verifica subárvore direita
+    }
+}
+
+//! Função para realizar a interseção de duas árvores AVL
+AVL_TIPO *AVL_F(interseccao)(AVL_TIPO *A, AVL_TIPO *B) {
+    if (A == NULL) return AVL_F(criar)();
+    if (B == NULL || A->raiz == NULL || B->raiz == NULL) return AVL_F(criar_com_alocador)(A->mem); // Retorna árvore vazia se A ou B forem nulas
+
+    AVL_TIPO *interseccao = AVL_F(clonar)(A); // Parte de A; as subárvores sem remoções continuam compartilhadas
+    if (interseccao == NULL) return NULL;
+    AVL_F(remover_ausentes)(A->raiz, B, interseccao); // Mantém apenas os elementos comuns entre A e B
+
+    return interseccao; // Retorna a árvore com a interseção dos elementos
+}
+
+// Transforma a árvore em uma "vinha": lista em ordem crescente encadeada pelo ponteiro
+// 'dir', feita por rotações à direita, sem pilha nem alocação (Day-Stout-Warren). Nenhum
+// nó pode ser compartilhado (veja AVL_F(tornar_exclusiva))
+static AVL_NO *AVL_F(vinha)(AVL_NO *raiz) {
+    AVL_NO cabeca;
+    AVL_NO *cauda = &cabeca;
+    cabeca.dir = raiz;
+    while (cauda->dir != NULL) {
+        AVL_NO *resto = cauda->dir;
+        if (resto->esq == NULL) {
+            cauda = resto; // Já está na lista; avança
+        } else {
+            AVL_NO *esq = resto->esq;
+            resto->esq = esq->dir; // Rotação à direita sobre 'resto'
+            esq->dir = resto;
+            cauda->dir = esq;
+        }
+    }
+    return cabeca.dir;
+}
+
+// Monta uma árvore perfeitamente balanceada com os 'n' primeiros nós da vinha '*lista',
+// reaproveitando os próprios nós, e avança '*lista'
+static AVL_NO *AVL_F(construir_vinha)(AVL_NO **lista, int n) {
+    if (n <= 0) return NULL;
+
+    AVL_NO *esq = AVL_F(construir_vinha)(lista, n / 2);
+    AVL_NO *no = *lista;
+    *lista = no->dir;
+    no->esq = esq;
+    no->dir = AVL_F(construir_vinha)(lista, n - n / 2 - 1);
+    AVL_F(atualizar_altura)(no);
+    return no;
+}
+
+// Próxima chave de B: da vinha '*vinha_b' (o nó sai da lista e vai para '*no') ou,
+// se ela não existir, do iterador 'it' (e '*no' fica NULL)
+static bool AVL_F(proximo_b)(AVL_NO **vinha_b, AVL_ITERADOR_TIPO *it, AVL_CHAVE *chave, AVL_NO **no) {
+    if (it != NULL) {
+        *no = NULL;
+        return AVL_F(iterador_proximo)(it, chave);
+    }
+    if (*vinha_b == NULL) return false;
+    *no = *vinha_b;
+    *vinha_b = (*no)->dir;
+    *chave = (*no)->chave;
+    return true;
+}
+
+// União ou interseção feita dentro de A: a árvore de A vira uma vinha, que é intercalada
+// em ordem com as chaves de B (vindas da vinha 'vinha_b', cujos nós são reaproveitados, ou
+// do iterador 'it_b'); os nós que sobram são liberados na mesma passada e o resultado é
+// remontado balanceado em O(n + m)
+static bool AVL_F(combinar_em)(AVL_TIPO *A, AVL_NO *vinha_b, AVL_ITERADOR_TIPO *it_b, bool uniao) {
+    ALOCADOR *mem = A->mem;
+    AVL_NO *a = AVL_F(vinha)(A->raiz);
+    AVL_NO cabeca, *cauda = &cabeca, *no = NULL;
+    AVL_CHAVE chave = {0}; // Só é lida quando tem_b (iniciada para o otimizador não acusar uso sem valor)
+    bool ok = true;
+    int n = 0;
+
+    bool tem_b = AVL_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+    while (a != NULL || tem_b) {
+        if (a == NULL || (tem_b && AVL_MENOR(chave, a->chave))) {
+            // Chave só de B: entra na união (com o nó de B ou um novo, já reservado) e some da interseção
+            if (uniao) {
+                if (no == NULL && (no = AVL_F(criar_no)(mem, chave)) == NULL) {
+                    ok = false;
+                } else {
+                    cauda = cauda->dir = no;
+                    n++;
+                }
+            } else {
+                alocador_liberar(mem, no, sizeof(AVL_NO));
+            }
+            tem_b = AVL_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+        } else {
+            AVL_NO *proximo = a->dir;
+            if (tem_b && AVL_IGUAL(chave, a->chave)) {
+                alocador_liberar(mem, no, sizeof(AVL_NO)); // Chave dos dois lados: fica o nó de A
+                tem_b = AVL_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+                cauda = cauda->dir = a;
+                n++;
+            } else if (uniao) {
+                cauda = cauda->dir = a; // Chave só de A
+                n++;
+            } else {
+                alocador_liberar(mem, a, sizeof(AVL_NO));
+            }
+            a = proximo;
+        }
+    }
+    cauda->dir = NULL;
+
+    AVL_NO *lista = cabeca.dir;
+    A->raiz = AVL_F(construir_vinha)(&lista, n);
+    AVL_F(atualizar_extremos)(A);
+    if (!ok) fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+    return ok;
+}
+
+// Conta as chaves de B que faltam em A, percorrendo as duas em ordem: são os nós que a
+// união dentro de A precisa criar. Retorna -1 se faltar memória para os iteradores
+static int AVL_F(contar_novas)(AVL_TIPO *A, AVL_TIPO *B) {
+    AVL_ITERADOR_TIPO *it_a = AVL_F(iterador_criar)(A), *it_b = AVL_F(iterador_criar)(B);
+    int novas = -1;
+    if (it_a != NULL && it_b != NULL) {
+        AVL_CHAVE a = {0}, b = {0};
+        bool tem_a = AVL_F(iterador_proximo)(it_a, &a), tem_b = AVL_F(iterador_proximo)(it_b, &b);
+        novas = 0;
+        while (tem_b) {
+            if (!tem_a || AVL_MENOR(b, a)) {
+                novas++;
+                tem_b = AVL_F(iterador_proximo)(it_b, &b);
+            } else {
+                if (AVL_IGUAL(a, b)) tem_b = AVL_F(iterador_proximo)(it_b, &b);
+                tem_a = AVL_F(iterador_proximo)(it_a, &a);
+            }
+        }
+    }
+    AVL_F(iterador_apagar)(&it_a);
+    AVL_F(iterador_apagar)(&it_b);
+    return novas;
+}
+
+// Prepara a combinação com B sem alterá-lo: as chaves de B são lidas por um iterador
+static bool AVL_F(combinar_com)(AVL_TIPO *A, AVL_TIPO *B, bool uniao) {
+    if (A == NULL) return false;
+    if (A == B) return true; // A ∪ A = A ∩ A = A
+
+    // A é desmontada no lugar: antes, os nós que ela divide com clones são copiados
+    if (alocador_compartilhado(A->mem) && !AVL_F(tornar_exclusiva)(A->mem, &A->raiz)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    // A união cria um nó para cada chave que só B tem: eles são reservados antes da
+    // intercalação, e a falta de memória não deixa a união pela metade
+    int novas = uniao ? AVL_F(contar_novas)(A, B) : 0;
+    if (novas < 0 || (novas > 0 && !alocador_reservar(A->mem, novas, sizeof(AVL_NO)))) return false;
+    AVL_ITERADOR_TIPO *it = AVL_F(iterador_criar)(B);
+    if (it == NULL) return false;
+    bool ok = AVL_F(combinar_em)(A, NULL, it, uniao);
+    AVL_F(iterador_apagar)(&it);
+    return ok;
+}
+
+// Prepara a combinação consumindo B: a árvore de B vira uma vinha cujos nós são
+// movidos para A ou liberados, e a estrutura de B é apagada
+static bool AVL_F(combinar_consumindo)(AVL_TIPO *A, AVL_TIPO **B, bool uniao) {
+    if (A == NULL || B == NULL || *B == NULL || *B == A) return false;
+    // Os nós de B só mudam de dono se o alocador de A puder liberá-los, e os compartilhados
+    // só podem ser movidos depois de copiados; se não der para copiá-los, B é lida e apagada
+    ALOCADOR *mem_b = (*B)->mem;
+    if (!alocador_compativel(mem_b, A->mem) ||
+        (alocador_compartilhado(mem_b) && !AVL_F(tornar_exclusiva)(mem_b, &(*B)->raiz)) ||
+        (alocador_compartilhado(A->mem) && !AVL_F(tornar_exclusiva)(A->mem, &A->raiz))) {
+        bool ok = AVL_F(combinar_com)(A, *B, uniao);
+        AVL_F(apagar)(B);
+        return ok;
+    }
+
+    AVL_NO *vinha_b = AVL_F(vinha)((*B)->raiz);
+    (*B)->raiz = NULL;
+    if (mem_b != A->mem) {
+        // Cada conjunto tem o seu alocador: os nós de B passam para a contabilidade de A
+        size_t n = 0;
+        for (AVL_NO *no = vinha_b; no != NULL; no = no->dir) n++;
+        alocador_transferir(mem_b, A->mem, n * sizeof(AVL_NO));
+    }
+    AVL_F(apagar)(B);
+    return AVL_F(combinar_em)(A, vinha_b, NULL, uniao);
+}
+
+//! A recebe a união de A e B; B não é alterada
+bool AVL_F(uniao_em)(AVL_TIPO *A, AVL_TIPO *B) {
+    return AVL_F(combinar_com)(A, B, true);
+}
+
+//! A recebe a interseção de A e B; B não é alterada
+bool AVL_F(interseccao_em)(AVL_TIPO *A, AVL_TIPO *B) {
+    return AVL_F(combinar_com)(A, B, false);
+}
+
+//! A recebe a união de A e B, reaproveitando os nós de B; B é apagada
+bool AVL_F(uniao_em_consumindo)(AVL_TIPO *A, AVL_TIPO **B) {
+    return AVL_F(combinar_consumindo)(A, B, true);
+}
+
+//! A recebe a interseção de A e B; os nós de B são liberados e B é apagada
+bool AVL_F(interseccao_em_consumindo)(AVL_TIPO *A, AVL_TIPO **B) {
+    return AVL_F(combinar_consumindo)(A, B, false);
+}
+
+// Percorre a subárvore conferindo as invariantes; 'min' e 'max' (quando não nulos) limitam
+// as chaves permitidas. Retorna a altura real da subárvore
+static int AVL_F(auditar_no)(AVL_NO *no, const AVL_CHAVE *min, const AVL_CHAVE *max, int *elementos, int *violacoes) {
+    if (no == NULL) return 0;
+
+    (*elementos)++;
+    if ((min != NULL && !AVL_MENOR(*min, no->chave)) || (max != NULL && !AVL_MENOR(no->chave, *max))) {
+        (*violacoes)++; // Chave fora de ordem
+    }
+    int esq = AVL_F(auditar_no)(no->esq, min, &no->chave, elementos, violacoes);
+    int dir = AVL_F(auditar_no)(no->dir, &no->chave, max, elementos, violacoes);
+    int altura = 1 + (esq > dir ? esq : dir);
+
+    if (no->altura != altura) (*violacoes)++;      // Altura armazenada desatualizada
+    if (esq - dir > 1 || dir - esq > 1) (*violacoes)++; // Nó desbalanceado
+    return altura;
+}
+
+//! Verifica as invariantes da árvore AVL e mede sua profundidade
+int AVL_F(auditar)(AVL_TIPO *T, int *elementos, int *profundidade) {
+    int violacoes = 0;
+    *elementos = 0;
+    *profundidade = AVL_F(auditar_no)(T ? T->raiz : NULL, NULL, NULL, elementos, &violacoes);
+    return violacoes;
+}
+
+// Constrói uma árvore perfeitamente balanceada com as 'n' chaves ordenadas: a chave do
+// meio vira a raiz e cada metade vira uma subárvore. '*ok' vira false se faltar memória
+static AVL_NO *AVL_F(construir)(ALOCADOR *mem, const AVL_CHAVE *chaves, int n, bool *ok) {
+    if (n <= 0 || !*ok) return NULL;
+
+    int meio = n / 2;
+    AVL_NO *no = AVL_F(criar_no)(mem, chaves[meio]);
+    if (no == NULL) {
+        *ok = false;
+        return NULL;
+    }
+    no->esq = AVL_F(construir)(mem, chaves, meio, ok);
+    no->dir = AVL_F(construir)(mem, chaves + meio + 1, n - meio - 1, ok);
+    AVL_F(atualizar_altura)(no);
+    return no;
+}
+
+//! Reconstrói a árvore AVL com balanceamento perfeito em O(n), reaproveitando os nós
+bool AVL_F(rebalancear)(AVL_TIPO *T) {
+    if (T == NULL || T->raiz == NULL) return T != NULL;
+
+    // A árvore é desmontada no lugar: só os nós que ela divide com clones são copiados antes
+    if (alocador_compartilhado(T->mem) && !AVL_F(tornar_exclusiva)(T->mem, &T->raiz)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+
+    AVL_NO *lista = AVL_F(vinha)(T->raiz);
+    int n = 0;
+    for (AVL_NO *no = lista; no != NULL; no = no->dir) n++;
+    T->raiz = AVL_F(construir_vinha)(&lista, n);
+    return true;
+}
+
+//! Carrega a árvore AVL em bloco a partir de chaves já ordenadas
+bool AVL_F(carregar_ordenadas)(AVL_TIPO *T, const AVL_CHAVE *chaves, int n) {
+    if (T == NULL || n < 0) return false;
+    for (int i = 1; i < n; i++) {
+        if (!AVL_MENOR(chaves[i - 1], chaves[i])) return false; // Fora de ordem ou repetida
+    }
+
+    bool ok = true;
+    AVL_NO *raiz = AVL_F(construir)(T->mem, chaves, n, &ok);
+    if (!ok) {
+        AVL_F(apagar_aux)(T->mem, &raiz);
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    AVL_F(apagar_aux)(T->mem, &T->raiz);
+    T->raiz = raiz;
+    if (n > 0) {
+        T->minimo = chaves[0];
+        T->maximo = chaves[n - 1];
+    }
+    return true;
+}
+
+//! Retorna a menor chave da árvore AVL em O(1)
+bool AVL_F(minimo)(AVL_TIPO *T, AVL_CHAVE *chave) {
+    if (T == NULL || T->raiz == NULL) return false;
+    *chave = T->minimo;
+    return true;
+}
+
+//! Retorna a maior chave da árvore AVL em O(1)
+bool AVL_F(maximo)(AVL_TIPO *T, AVL_CHAVE *chave) {
+    if (T == NULL || T->raiz == NULL) return false;
+    *chave = T->maximo;
+    return true;
+}
+
+// Desce uma vez da raiz procurando a chave mais próxima de 'chave' acima dela ('acima')
+// ou abaixo; se 'inclusivo', a própria chave também serve
+static bool AVL_F(vizinho)(AVL_TIPO *T, AVL_CHAVE chave, bool acima, bool inclusivo, AVL_CHAVE *resultado) {
+    bool achou = false;
+    AVL_NO *no = T ? T->raiz : NULL;
+    while (no != NULL) {
+        int c = AVL_COMPARAR(no->chave, chave);
+        if (c == 0 && inclusivo) {
+            *resultado = no->chave;
+            return true;
+        }
+        if (acima ? c > 0 : c < 0) {
+            *resultado = no->chave; // Candidata; pode haver outra mais próxima no lado de dentro
+            achou = true;
+            no = acima ? no->esq : no->dir;
+        } else {
+            no = acima ? no->dir : no->esq;
+        }
+    }
+    return achou;
+}
+
+//! Menor chave maior que 'chave'
+bool AVL_F(sucessor)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado) {
+    return AVL_F(vizinho)(T, chave, true, false, resultado);
+}
+
+//! Maior chave menor que 'chave'
+bool AVL_F(antecessor)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado) {
+    return AVL_F(vizinho)(T, chave, false, false, resultado);
+}
+
+//! Maior chave menor ou igual a 'chave'
+bool AVL_F(piso)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado) {
+    return AVL_F(vizinho)(T, chave, false, true, resultado);
+}
+
+//! Menor chave maior ou igual a 'chave'
+bool AVL_F(teto)(AVL_TIPO *T, AVL_CHAVE chave, AVL_CHAVE *resultado) {
+    return AVL_F(vizinho)(T, chave, true, true, resultado);
+}
+
+// Estrutura do iterador: pilha explícita com os ancestrais ainda não visitados
+struct AVL_F(iterador) {
+    AVL_NO **pilha;     // Nós pendentes; o topo é o próximo a ser visitado
+    int topo;       // Quantidade de nós na pilha
+    int capacidade; // Capacidade alocada da pilha
+};
+
+// Empilha o nó e todos os seus descendentes à esquerda
+static bool AVL_F(iterador_descer)(AVL_ITERADOR_TIPO *it, AVL_NO *no) {
+    while (no != NULL) {
+        if (it->topo == it->capacidade) { // Cresce a pilha se a árvore for mais alta que o previsto
+            int capacidade = it->capacidade ? 2 * it->capacidade : 32;
+            AVL_NO **pilha = (AVL_NO **)realloc(it->pilha, capacidade * sizeof(AVL_NO *));
+            if (pilha == NULL) return false;
+            it->pilha = pilha;
+            it->capacidade = capacidade;
+        }
+        it->pilha[it->topo++] = no;
+        no = no->esq;
+    }
+    return true;
+}
+
+//! Cria um iterador em ordem crescente sobre a árvore AVL
+AVL_ITERADOR_TIPO *AVL_F(iterador_criar)(AVL_TIPO *T) {
+    AVL_ITERADOR_TIPO *it = (AVL_ITERADOR_TIPO *)malloc(sizeof(AVL_ITERADOR_TIPO));
+    if (it == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    it->pilha = NULL;
+    it->topo = it->capacidade = 0;
+    if (T != NULL && !AVL_F(iterador_descer)(it, T->raiz)) {
+        AVL_F(iterador_apagar)(&it);
+        return NULL;
+    }
+    return it;
+}
+
+//! Retorna a próxima chave em ordem crescente
+bool AVL_F(iterador_proximo)(AVL_ITERADOR_TIPO *it, AVL_CHAVE *chave) {
+    if (it == NULL || it->topo == 0) return false; // Não há mais chaves
+
+    AVL_NO *no = it->pilha[--it->topo];  // Menor chave ainda não visitada
+    *chave = no->chave;
+    return AVL_F(iterador_descer)(it, no->dir); // Prepara o sucessor
+}
+
+//! Libera o iterador
+void AVL_F(iterador_apagar)(AVL_ITERADOR_TIPO **it) {
+    if (it == NULL || *it == NULL) return;
+    free((*it)->pilha);
+    free(*it);
+    *it = NULL;
+}
+
+#undef AVL_NO
+#endif // AVL_MODELO_IMPLEMENTAR
+
+#undef AVL_CHAVE
+#undef AVL_PREFIXO
+#undef AVL_TIPO
+#undef AVL_ITERADOR_TIPO
+#undef AVL_COMPARAR
+#undef AVL_IMPRIMIR_CHAVE
+#undef AVL_MODELO_SEM_DECLARACOES
+#undef AVL_MODELO_IMPLEMENTAR
+#undef AVL_CONCATENAR_
+#undef AVL_CONCATENAR
+#undef AVL_F
+#undef AVL_MENOR
+#undef AVL_IGUAL
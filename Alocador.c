@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Alocador.h"
+
+struct alocador {
+    SET_ALOCADOR base; // Funções do usuário (alocar NULL: malloc e free)
+    size_t em_uso;     // Bytes vivos alocados por este alocador
+    int ref;           // Quantidade de árvores que usam o alocador
+    void *reserva;     // Blocos reservados, encadeados pelo seu primeiro ponteiro
+    int n_reserva;     // Quantidade de blocos reservados
+    size_t tam_reserva; // Tamanho de cada bloco reservado
+};
+
+// Aloca e libera direto no alocador do usuário (ou malloc e free)
+static void *alocador_base_alocar(ALOCADOR *a, size_t tamanho) {
+    return a->base.alocar ? a->base.alocar(tamanho, a->base.contexto) : malloc(tamanho);
+}
+
+static void alocador_base_liberar(ALOCADOR *a, void *p, size_t tamanho) {
+    if (a->base.alocar) a->base.liberar(p, tamanho, a->base.contexto);
+    else free(p);
+}
+
+// Devolve todos os blocos da reserva
+static void alocador_esvaziar_reserva(ALOCADOR *a) {
+    while (a->reserva != NULL) {
+        void *p = a->reserva;
+        a->reserva = *(void **)p;
+        a->em_uso -= a->tam_reserva;
+        alocador_base_liberar(a, p, a->tam_reserva);
+    }
+    a->n_reserva = 0;
+}
+
+//! Cria a contabilidade sobre 'base'
+ALOCADOR *alocador_criar(const SET_ALOCADOR *base) {
+    if (base != NULL && base->alocar != NULL && base->liberar == NULL) return NULL; // Par incompleto
+
+    ALOCADOR *a;
+    if (base != NULL && base->alocar != NULL) a = (ALOCADOR *)base->alocar(sizeof(ALOCADOR), base->contexto);
+    else a = (ALOCADOR *)malloc(sizeof(ALOCADOR));
+    if (a == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    a->base.alocar = base ? base->alocar : NULL;
+    a->base.liberar = base ? base->liberar : NULL;
+    a->base.contexto = base ? base->contexto : NULL;
+    a->em_uso = sizeof(ALOCADOR);
+    a->ref = 1;
+    a->reserva = NULL;
+    a->n_reserva = 0;
+    a->tam_reserva = 0;
+    return a;
+}
+
+//! Mais uma árvore passa a usar o alocador
+ALOCADOR *alocador_reter(ALOCADOR *a) {
+    if (a != NULL) a->ref++;
+    return a;
+}
+
+//! Uma árvore deixa de usar o alocador
+void alocador_soltar(ALOCADOR **a) {
+    if (a == NULL || *a == NULL) return;
+    if (--(*a)->ref <= 1) alocador_esvaziar_reserva(*a); // Sem outra árvore, nada é compartilhado
+    if ((*a)->ref == 0) alocador_liberar(*a, *a, sizeof(ALOCADOR));
+    *a = NULL;
+}
+
+//! Aloca 'tamanho' bytes, da reserva se houver blocos desse tamanho
+void *alocador_alocar(ALOCADOR *a, size_t tamanho) {
+    if (a->n_reserva > 0 && tamanho == a->tam_reserva) {
+        void *p = a->reserva;
+        a->reserva = *(void **)p;
+        a->n_reserva--;
+        return p; // Já contado em 'em_uso'
+    }
+    void *p = alocador_base_alocar(a, tamanho);
+    if (p != NULL) a->em_uso += tamanho;
+    return p;
+}
+
+//! Libera 'tamanho' bytes
+void alocador_liberar(ALOCADOR *a, void *p, size_t tamanho) {
+    if (p == NULL) return;
+    a->em_uso -= tamanho;
+    alocador_base_liberar(a, p, tamanho);
+}
+
+//! Bytes vivos
+size_t alocador_em_uso(ALOCADOR *a) {
+    return a ? a->em_uso : 0;
+}
+
+//! Mais de uma árvore usa o alocador
+bool alocador_compartilhado(ALOCADOR *a) {
+    return a != NULL && a->ref > 1;
+}
+
+//! Os dois alocadores liberam o que o outro aloca
+bool alocador_compativel(ALOCADOR *a, ALOCADOR *b) {
+    if (a == NULL || b == NULL) return false;
+    return a == b || (a->base.alocar == b->base.alocar && a->base.liberar == b->base.liberar &&
+                      a->base.contexto == b->base.contexto);
+}
+
+//! Move a contabilidade de blocos que mudaram de dono
+void alocador_transferir(ALOCADOR *de, ALOCADOR *para, size_t bytes) {
+    if (de == para) return;
+    de->em_uso -= bytes;
+    para->em_uso += bytes;
+}
+
+//! Reserva blocos para as próximas 'n' alocações de 'tamanho' bytes
+bool alocador_reservar(ALOCADOR *a, int n, size_t tamanho) {
+    if (a == NULL || tamanho < sizeof(void *)) return false;
+    if (tamanho != a->tam_reserva) {
+        alocador_esvaziar_reserva(a);
+        a->tam_reserva = tamanho;
+    }
+    while (a->n_reserva < n) {
+        void *p = alocador_base_alocar(a, tamanho);
+        if (p == NULL) {
+            fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+            return false;
+        }
+        *(void **)p = a->reserva;
+        a->reserva = p;
+        a->n_reserva++;
+        a->em_uso += tamanho;
+    }
+    return true;
+}
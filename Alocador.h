@@ -0,0 +1,57 @@
+#ifndef _CONJUNTO_ALOCADOR_H
+#define _CONJUNTO_ALOCADOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Alocador fornecido pelo usuário para os nós e os cabeçalhos das árvores de um conjunto
+// (arenas, pools de páginas grandes, pools locais a um nó NUMA...). 'liberar' recebe o
+// mesmo tamanho pedido a 'alocar'; 'contexto' é repassado às duas sem ser interpretado.
+// Com 'alocar' NULL são usados malloc e free
+typedef struct set_alocador {
+    void *(*alocar)(size_t tamanho, void *contexto);
+    void (*liberar)(void *p, size_t tamanho, void *contexto);
+    void *contexto;
+} SET_ALOCADOR;
+
+// Contabilidade compartilhada por uma árvore e tudo o que divide nós com ela (clones e
+// resultados de operações), que por isso precisam usar o mesmo alocador. É liberada
+// quando a última árvore que a usa é apagada
+typedef struct alocador ALOCADOR;
+
+// Cria a contabilidade sobre 'base' (NULL para malloc e free); ela mesma é alocada por 'base'
+ALOCADOR *alocador_criar(const SET_ALOCADOR *base);
+
+// Mais uma árvore passa a usar o alocador
+ALOCADOR *alocador_reter(ALOCADOR *a);
+
+// Uma árvore deixa de usar o alocador; o último a soltar libera a contabilidade
+void alocador_soltar(ALOCADOR **a);
+
+// Aloca e libera 'tamanho' bytes, contando os bytes vivos
+void *alocador_alocar(ALOCADOR *a, size_t tamanho);
+void alocador_liberar(ALOCADOR *a, void *p, size_t tamanho);
+
+// Bytes vivos: nós, cabeçalhos das árvores, blocos da reserva e a própria contabilidade
+size_t alocador_em_uso(ALOCADOR *a);
+
+// True se mais de uma árvore usa o alocador: só então pode haver nós compartilhados, que
+// precisam ser copiados antes de qualquer alteração
+bool alocador_compartilhado(ALOCADOR *a);
+
+// True se os dois alocadores usam as mesmas funções e o mesmo contexto, e portanto um
+// libera o que o outro alocou: nós podem passar de uma árvore para a outra
+bool alocador_compativel(ALOCADOR *a, ALOCADOR *b);
+
+// Passa de 'de' para 'para' a contabilidade de 'bytes' vivos, de blocos que mudaram de
+// dono entre dois alocadores compatíveis
+void alocador_transferir(ALOCADOR *de, ALOCADOR *para, size_t bytes);
+
+// Garante que as próximas 'n' alocações de 'tamanho' bytes não falhem, guardando blocos já
+// alocados. Uma operação que copia nós compartilhados no meio do caminho reserva antes o
+// máximo que pode copiar, e assim nunca para pela metade. Retorna false se faltar memória
+// (os blocos já reservados ficam para a próxima vez). A reserva é devolvida quando o
+// alocador volta a ter uma única árvore
+bool alocador_reservar(ALOCADOR *a, int n, size_t tamanho);
+
+#endif
@@ -0,0 +1,3 @@
+// Gera as definições de todas as instâncias declaradas em Chaves.h
+#define CHAVES_IMPLEMENTAR
+#include "Chaves.h"
@@ -0,0 +1,126 @@
+#ifndef _CHAVES_H
+#define _CHAVES_H
+
+// Árvores AVL, LLRB e splay especializadas para outros tipos de chave além de int.
+// Cada instância é gerada pelos modelos AVL_modelo.h, LLRB_modelo.h e Splay_modelo.h com seu próprio
+// layout de nó e sua comparação expandida em linha. Para gerar uma nova instância,
+// acrescente um bloco abaixo; Chaves.c define CHAVES_IMPLEMENTAR antes de incluir
+// este cabeçalho para gerar as definições de todas elas.
+//
+//   Chave       AVL (prefixo)          LLRB (prefixo)           Splay (prefixo)
+//   int64_t     AVL_I64 (avl_i64_)     LLRB_I64 (llrb_i64_)     SPLAY_I64 (splay_i64_)
+//   uint32_t    AVL_U32 (avl_u32_)     LLRB_U32 (llrb_u32_)     SPLAY_U32 (splay_u32_)
+//   ID128       AVL_ID128 (avl_id128_) LLRB_ID128 (llrb_id128_) SPLAY_ID128 (splay_id128_)
+
+#include <stdint.h>
+#include <inttypes.h>
+
+// Identificador de 128 bits, ordenado pela parte alta e depois pela baixa
+typedef struct {
+    uint64_t alto;
+    uint64_t baixo;
+} ID128;
+
+// Comparação de ID128: negativo, zero ou positivo
+static inline int id128_comparar(ID128 a, ID128 b) {
+    if (a.alto != b.alto) return a.alto < b.alto ? -1 : 1;
+    return (a.baixo > b.baixo) - (a.baixo < b.baixo);
+}
+
+// Chaves int64_t
+#define AVL_CHAVE int64_t
+#define AVL_PREFIXO avl_i64
+#define AVL_TIPO AVL_I64
+#define AVL_ITERADOR_TIPO AVL_I64_ITERADOR
+#define AVL_IMPRIMIR_CHAVE(c) printf("%" PRId64 " ", (c))
+#ifdef CHAVES_IMPLEMENTAR
+#define AVL_MODELO_IMPLEMENTAR
+#endif
+#include "AVL_modelo.h"
+
+#define LLRB_CHAVE int64_t
+#define LLRB_PREFIXO llrb_i64
+#define LLRB_TIPO LLRB_I64
+#define LLRB_ITERADOR_TIPO LLRB_I64_ITERADOR
+#define LLRB_IMPRIMIR_CHAVE(c) printf("%" PRId64 " ", (c))
+#ifdef CHAVES_IMPLEMENTAR
+#define LLRB_MODELO_IMPLEMENTAR
+#endif
+#include "LLRB_modelo.h"
+
+#define SPLAY_CHAVE int64_t
+#define SPLAY_PREFIXO splay_i64
+#define SPLAY_TIPO SPLAY_I64
+#define SPLAY_ITERADOR_TIPO SPLAY_I64_ITERADOR
+#define SPLAY_IMPRIMIR_CHAVE(c) printf("%" PRId64 " ", (c))
+#ifdef CHAVES_IMPLEMENTAR
+#define SPLAY_MODELO_IMPLEMENTAR
+#endif
+#include "Splay_modelo.h"
+
+// Chaves uint32_t
+#define AVL_CHAVE uint32_t
+#define AVL_PREFIXO avl_u32
+#define AVL_TIPO AVL_U32
+#define AVL_ITERADOR_TIPO AVL_U32_ITERADOR
+#define AVL_IMPRIMIR_CHAVE(c) printf("%" PRIu32 " ", (c))
+#ifdef CHAVES_IMPLEMENTAR
+#define AVL_MODELO_IMPLEMENTAR
+#endif
+#include "AVL_modelo.h"
+
+#define LLRB_CHAVE uint32_t
+#define LLRB_PREFIXO llrb_u32
+#define LLRB_TIPO LLRB_U32
+#define LLRB_ITERADOR_TIPO LLRB_U32_ITERADOR
+#define LLRB_IMPRIMIR_CHAVE(c) printf("%" PRIu32 " ", (c))
+#ifdef CHAVES_IMPLEMENTAR
+#define LLRB_MODELO_IMPLEMENTAR
+#endif
+#include "LLRB_modelo.h"
+
+#define SPLAY_CHAVE uint32_t
+#define SPLAY_PREFIXO splay_u32
+#define SPLAY_TIPO SPLAY_U32
+#define SPLAY_ITERADOR_TIPO SPLAY_U32_ITERADOR
+#define SPLAY_IMPRIMIR_CHAVE(c) printf("%" PRIu32 " ", (c))
+#ifdef CHAVES_IMPLEMENTAR
+#define SPLAY_MODELO_IMPLEMENTAR
+#endif
+#include "Splay_modelo.h"
+
+// Chaves ID128
+#define AVL_CHAVE ID128
+#define AVL_PREFIXO avl_id128
+#define AVL_TIPO AVL_ID128
+#define AVL_ITERADOR_TIPO AVL_ID128_ITERADOR
+#define AVL_COMPARAR(a, b) id128_comparar(a, b)
+#define AVL_IMPRIMIR_CHAVE(c) printf("%016" PRIx64 "%016" PRIx64 " ", (c).alto, (c).baixo)
+#ifdef CHAVES_IMPLEMENTAR
+#define AVL_MODELO_IMPLEMENTAR
+#endif
+#include "AVL_modelo.h"
+
+#define LLRB_CHAVE ID128
+#define LLRB_PREFIXO llrb_id128
+#define LLRB_TIPO LLRB_ID128
+#define LLRB_ITERADOR_TIPO LLRB_ID128_ITERADOR
+#define LLRB_COMPARAR(a, b) id128_comparar(a, b)
+#define LLRB_IMPRIMIR_CHAVE(c) printf("%016" PRIx64 "%016" PRIx64 " ", (c).alto, (c).baixo)
+#ifdef CHAVES_IMPLEMENTAR
+#define LLRB_MODELO_IMPLEMENTAR
+#endif
+#include "LLRB_modelo.h"
+
+#define SPLAY_CHAVE ID128
+#define SPLAY_PREFIXO splay_id128
+#define SPLAY_TIPO SPLAY_ID128
+#define SPLAY_ITERADOR_TIPO SPLAY_ID128_ITERADOR
+#define SPLAY_COMPARAR(a, b) id128_comparar(a, b)
+#define SPLAY_IMPRIMIR_CHAVE(c) printf("%016" PRIx64 "%016" PRIx64 " ", (c).alto, (c).baixo)
+#ifdef CHAVES_IMPLEMENTAR
+#define SPLAY_MODELO_IMPLEMENTAR
+#endif
+#include "Splay_modelo.h"
+
+#endif
@@ -0,0 +1,180 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "Conjunto.h"
+#include "Protocolo.h"
+
+// Cliente de teste do servidor de conjuntos.
+// Lê comandos de texto da entrada padrão, envia todas as requisições em pipeline
+// e depois imprime as respostas na ordem recebida. Comandos, um por linha:
+//   criar <nome> <avl|llrb|splay> apagar <nome>          elementos <nome>
+//   inserir <nome> <x>...       remover <nome> <x>...    pertence <nome> <x>...
+//   uniao <destino> <A> <B>     interseccao <destino> <A> <B>
+
+#define MAX_LINHA 4096
+
+typedef struct {
+    unsigned char *dados;
+    size_t tamanho;
+    size_t capacidade;
+} BUFFER;
+
+static void buffer_anexar(BUFFER *b, const void *p, size_t n) {
+    if (b->tamanho + n > b->capacidade) {
+        size_t capacidade = b->capacidade ? b->capacidade : 4096;
+        while (capacidade < b->tamanho + n) capacidade *= 2;
+        b->dados = (unsigned char *)realloc(b->dados, capacidade);
+        if (b->dados == NULL) {
+            fprintf(stderr, "Erro ao alocar memória.\n");
+            exit(1);
+        }
+        b->capacidade = capacidade;
+    }
+    memcpy(b->dados + b->tamanho, p, n);
+    b->tamanho += n;
+}
+
+// Converte o nome do comando para a operação do protocolo e a quantidade de nomes
+static int operacao(const char *cmd, int *n_nomes) {
+    static const struct { const char *nome; int op, n_nomes; } tabela[] = {
+        {"criar", PROTO_CRIAR, 1},       {"apagar", PROTO_APAGAR, 1},
+        {"inserir", PROTO_INSERIR, 1},   {"remover", PROTO_REMOVER, 1},
+        {"pertence", PROTO_PERTENCE, 1}, {"uniao", PROTO_UNIAO, 3},
+        {"interseccao", PROTO_INTERSECCAO, 3}, {"elementos", PROTO_ELEMENTOS, 1},
+    };
+    for (size_t i = 0; i < sizeof(tabela) / sizeof(tabela[0]); i++) {
+        if (strcmp(cmd, tabela[i].nome) == 0) {
+            *n_nomes = tabela[i].n_nomes;
+            return tabela[i].op;
+        }
+    }
+    return -1;
+}
+
+// Codifica uma linha de comando como requisição; retorna a operação ou -1
+static int codificar(char *linha, BUFFER *pedidos) {
+    char *cmd = strtok(linha, " \t\r\n");
+    int n_nomes, op;
+    if (cmd == NULL || cmd[0] == '#' || (op = operacao(cmd, &n_nomes)) < 0) return -1;
+
+    size_t inicio = pedidos->tamanho;
+    unsigned char cabecalho[PROTO_CABECALHO] = {0};
+    cabecalho[4] = (unsigned char)op;
+    cabecalho[6] = (unsigned char)n_nomes;
+    buffer_anexar(pedidos, cabecalho, sizeof(cabecalho));
+
+    for (int i = 0; i < n_nomes; i++) {
+        char *nome = strtok(NULL, " \t\r\n");
+        if (nome == NULL || strlen(nome) > 255) {
+            pedidos->tamanho = inicio;
+            return -1;
+        }
+        unsigned char n = (unsigned char)strlen(nome);
+        buffer_anexar(pedidos, &n, 1);
+        buffer_anexar(pedidos, nome, n);
+    }
+
+    char *arg;
+    while ((arg = strtok(NULL, " \t\r\n")) != NULL) {
+        if (op == PROTO_CRIAR) { // O argumento de criar é o tipo
+            pedidos->dados[inicio + 5] = strcmp(arg, "llrb") == 0 || strcmp(arg, "1") == 0 ? LLRB_TYPE
+                                       : strcmp(arg, "splay") == 0 || strcmp(arg, "2") == 0 ? SPLAY_TYPE : AVL_TYPE;
+        } else {
+            int32_t v = (int32_t)strtol(arg, NULL, 10);
+            buffer_anexar(pedidos, &v, sizeof(v));
+        }
+    }
+
+    uint32_t tamanho = (uint32_t)(pedidos->tamanho - inicio - sizeof(uint32_t));
+    memcpy(pedidos->dados + inicio, &tamanho, sizeof(tamanho));
+    return op;
+}
+
+// Imprime uma resposta de acordo com a operação
+static void imprimir_resposta(const unsigned char *q, uint32_t tamanho) {
+    uint8_t op = q[0], status = q[1];
+    const unsigned char *dados = q + 4;
+    uint32_t n = tamanho - 4;
+
+    if (status != PROTO_OK) {
+        printf("Erro\n");
+        return;
+    }
+    if (op == PROTO_INSERIR || op == PROTO_REMOVER) {
+        uint32_t alterados;
+        memcpy(&alterados, dados, sizeof(alterados));
+        printf("%u\n", alterados);
+    } else if (op == PROTO_PERTENCE) {
+        for (uint32_t i = 0; i < n; i++) printf(dados[i] ? "Pertence\n" : "Nao pertence\n");
+    } else if (op == PROTO_ELEMENTOS) {
+        for (uint32_t i = 0; i + sizeof(int32_t) <= n; i += sizeof(int32_t)) {
+            int32_t v;
+            memcpy(&v, dados + i, sizeof(v));
+            printf("%d ", v);
+        }
+        printf("\n");
+    } else {
+        printf("Ok\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Uso: %s <caminho do socket> < comandos\n", argv[0]);
+        return 1;
+    }
+
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strncpy(endereco.sun_path, argv[1], sizeof(endereco.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&endereco, sizeof(endereco)) < 0) {
+        perror("Erro ao conectar");
+        return 1;
+    }
+
+    // Todas as requisições vão em uma única sequência, sem esperar respostas
+    BUFFER pedidos = {0};
+    char linha[MAX_LINHA];
+    int enviados = 0;
+    while (fgets(linha, sizeof(linha), stdin) != NULL) {
+        if (codificar(linha, &pedidos) >= 0) enviados++;
+    }
+    for (size_t pos = 0; pos < pedidos.tamanho;) {
+        ssize_t n = write(fd, pedidos.dados + pos, pedidos.tamanho - pos);
+        if (n <= 0) {
+            perror("Erro ao enviar");
+            return 1;
+        }
+        pos += (size_t)n;
+    }
+    shutdown(fd, SHUT_WR);
+
+    // Lê as respostas até o servidor fechar a conexão
+    BUFFER respostas = {0};
+    unsigned char bloco[65536];
+    ssize_t n;
+    while ((n = read(fd, bloco, sizeof(bloco))) > 0) {
+        buffer_anexar(&respostas, bloco, (size_t)n);
+    }
+
+    int recebidos = 0;
+    for (size_t pos = 0; pos + PROTO_CABECALHO <= respostas.tamanho; recebidos++) {
+        uint32_t tamanho;
+        memcpy(&tamanho, respostas.dados + pos, sizeof(tamanho));
+        if (pos + sizeof(uint32_t) + tamanho > respostas.tamanho) break;
+        imprimir_resposta(respostas.dados + pos + sizeof(uint32_t), tamanho);
+        pos += sizeof(uint32_t) + tamanho;
+    }
+
+    free(pedidos.dados);
+    free(respostas.dados);
+    close(fd);
+    return recebidos != enviados;
+}
@@ -0,0 +1,506 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "Comprimido.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// As chaves são tratadas como uint32_t deslocados (chave ^ 0x80000000), que preservam a
+// ordem e fazem as diferenças caberem sempre em 32 bits sem sinal
+#define COMPRIMIDO_DESLOCAR(x) ((uint32_t)(x) ^ 0x80000000u)
+#define COMPRIMIDO_VOLTAR(u) ((int)((u) ^ 0x80000000u))
+
+// Layout de cada bloco em 'dados' (palavras de 32 bits):
+//   cabeçalho: largura em bits (8 bits) | exceções (8 bits) | chaves no bloco (16 bits)
+//   4 * largura palavras empacotadas: a diferença i fica na faixa i % 4 e as faixas são
+//   intercaladas palavra a palavra, de modo que um registrador SSE2 decodifica 4 de uma vez
+//   2 palavras por exceção: posição e bits altos da diferença
+// A primeira diferença do bloco é sempre 0; a primeira chave fica no índice 'minimos'.
+struct comprimido {
+    int n;             // Quantidade de chaves
+    int blocos;        // Quantidade de blocos
+    int maximo;        // Maior chave (válida se n > 0)
+    int ref;           // Quantidade de conjuntos que compartilham esta representação
+    int *minimos;      // Índice: primeira chave de cada bloco
+    uint32_t *inicio;  // Posição do cabeçalho de cada bloco em 'dados'
+    uint32_t *dados;   // Blocos empacotados
+    size_t palavras;   // Palavras usadas em 'dados'
+    size_t capacidade; // Palavras alocadas em 'dados'
+    int capacidade_blocos;
+};
+
+struct comprimido_iterador {
+    COMPRIMIDO *c;
+    int bloco;                      // Próximo bloco a decodificar
+    int pos, quantidade;            // Posição e total de chaves decodificadas em 'chaves'
+    int chaves[COMPRIMIDO_BLOCO];
+};
+
+// Máscara com os 'b' bits baixos
+static uint32_t comprimido_mascara(int b) {
+    return b >= 32 ? 0xFFFFFFFFu : ((uint32_t)1 << b) - 1;
+}
+
+// Quantos bits são necessários para representar 'v'
+static int comprimido_largura(uint32_t v) {
+    int b = 0;
+    while (v != 0) {
+        b++;
+        v >>= 1;
+    }
+    return b;
+}
+
+// Garante espaço para mais 'palavras' em 'dados' e mais um bloco no índice
+static bool comprimido_reservar(COMPRIMIDO *c, size_t palavras) {
+    if (c->palavras + palavras > c->capacidade) {
+        size_t capacidade = c->capacidade ? 2 * c->capacidade : 256;
+        while (capacidade < c->palavras + palavras) capacidade *= 2;
+        uint32_t *dados = (uint32_t *)realloc(c->dados, capacidade * sizeof(uint32_t));
+        if (dados == NULL) return false;
+        c->dados = dados;
+        c->capacidade = capacidade;
+    }
+    if (c->blocos == c->capacidade_blocos) {
+        int capacidade = c->capacidade_blocos ? 2 * c->capacidade_blocos : 16;
+        int *minimos = (int *)realloc(c->minimos, capacidade * sizeof(int));
+        if (minimos == NULL) return false;
+        c->minimos = minimos;
+        uint32_t *inicio = (uint32_t *)realloc(c->inicio, capacidade * sizeof(uint32_t));
+        if (inicio == NULL) return false;
+        c->inicio = inicio;
+        c->capacidade_blocos = capacidade;
+    }
+    return true;
+}
+
+// Cria uma representação vazia
+static COMPRIMIDO *comprimido_vazio(void) {
+    COMPRIMIDO *c = (COMPRIMIDO *)calloc(1, sizeof(COMPRIMIDO));
+    if (c == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    c->ref = 1;
+    return c;
+}
+
+// Devolve a folga dos vetores depois que a representação fica pronta
+static void comprimido_ajustar(COMPRIMIDO *c) {
+    if (c->palavras > 0 && c->palavras < c->capacidade) {
+        uint32_t *dados = (uint32_t *)realloc(c->dados, c->palavras * sizeof(uint32_t));
+        if (dados != NULL) {
+            c->dados = dados;
+            c->capacidade = c->palavras;
+        }
+    }
+    if (c->blocos > 0 && c->blocos < c->capacidade_blocos) {
+        int *minimos = (int *)realloc(c->minimos, c->blocos * sizeof(int));
+        if (minimos != NULL) c->minimos = minimos;
+        uint32_t *inicio = (uint32_t *)realloc(c->inicio, c->blocos * sizeof(uint32_t));
+        if (inicio != NULL) c->inicio = inicio;
+        if (minimos != NULL && inicio != NULL) c->capacidade_blocos = c->blocos;
+    }
+}
+
+// Comprime e acrescenta um bloco com 'n' (1 a COMPRIMIDO_BLOCO) chaves crescentes
+static bool comprimido_acrescentar(COMPRIMIDO *c, const int *chaves, int n) {
+    uint32_t delta[COMPRIMIDO_BLOCO] = {0};
+    int histograma[33] = {0};
+    for (int i = 1; i < n; i++) {
+        delta[i] = COMPRIMIDO_DESLOCAR(chaves[i]) - COMPRIMIDO_DESLOCAR(chaves[i - 1]);
+        histograma[comprimido_largura(delta[i])]++;
+    }
+
+    // Largura que minimiza o tamanho: 16 bytes por bit de largura mais 8 por exceção
+    int b = 32, excecoes = 0, acima = 0;
+    size_t melhor = (size_t)-1;
+    for (int largura = 32; largura >= 0; largura--) {
+        size_t custo = 16 * (size_t)largura + 8 * (size_t)acima;
+        if (acima < 256 && custo <= melhor) {
+            melhor = custo;
+            b = largura;
+            excecoes = acima;
+        }
+        acima += histograma[largura];
+    }
+
+    if (!comprimido_reservar(c, 1 + 4 * (size_t)b + 2 * (size_t)excecoes)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    c->minimos[c->blocos] = chaves[0];
+    c->inicio[c->blocos] = (uint32_t)c->palavras;
+    c->blocos++;
+
+    uint32_t *p = c->dados + c->palavras;
+    p[0] = (uint32_t)b | ((uint32_t)excecoes << 8) | ((uint32_t)n << 16);
+    uint32_t *empacotado = p + 1;
+    memset(empacotado, 0, 4 * (size_t)b * sizeof(uint32_t));
+    uint32_t *excecao = empacotado + 4 * b;
+    uint32_t mascara = comprimido_mascara(b);
+
+    for (int i = 0; i < COMPRIMIDO_BLOCO && b > 0; i++) {
+        uint32_t v = delta[i] & mascara;
+        int faixa = i % 4, bit = (i / 4) * b, palavra = bit / 32, desloc = bit % 32;
+        empacotado[4 * palavra + faixa] |= v << desloc;
+        if (desloc + b > 32) empacotado[4 * (palavra + 1) + faixa] |= v >> (32 - desloc);
+    }
+    for (int i = 0; i < n; i++) {
+        if (b < 32 && (delta[i] >> b) != 0) {
+            *excecao++ = (uint32_t)i;
+            *excecao++ = delta[i] >> b;
+        }
+    }
+    c->palavras += 1 + 4 * (size_t)b + 2 * (size_t)excecoes;
+    c->n += n;
+    c->maximo = chaves[n - 1];
+    return true;
+}
+
+// Desempacota as COMPRIMIDO_BLOCO diferenças de 'b' bits
+static void comprimido_desempacotar(const uint32_t *empacotado, int b, uint32_t *delta) {
+    if (b == 0) {
+        memset(delta, 0, COMPRIMIDO_BLOCO * sizeof(uint32_t));
+        return;
+    }
+#ifdef __SSE2__
+    // As 4 faixas usam os mesmos deslocamentos: cada passo produz 4 diferenças consecutivas
+    __m128i mascara = _mm_set1_epi32((int)comprimido_mascara(b));
+    for (int i = 0; i < COMPRIMIDO_BLOCO / 4; i++) {
+        int bit = i * b, palavra = bit / 32, desloc = bit % 32;
+        __m128i v = _mm_srl_epi32(_mm_loadu_si128((const __m128i *)(empacotado + 4 * palavra)), _mm_cvtsi32_si128(desloc));
+        if (desloc + b > 32) {
+            __m128i alto = _mm_loadu_si128((const __m128i *)(empacotado + 4 * (palavra + 1)));
+            v = _mm_or_si128(v, _mm_sll_epi32(alto, _mm_cvtsi32_si128(32 - desloc)));
+        }
+        _mm_storeu_si128((__m128i *)(delta + 4 * i), _mm_and_si128(v, mascara));
+    }
+#else
+    uint32_t mascara = comprimido_mascara(b);
+    for (int i = 0; i < COMPRIMIDO_BLOCO; i++) {
+        int faixa = i % 4, bit = (i / 4) * b, palavra = bit / 32, desloc = bit % 32;
+        uint32_t v = empacotado[4 * palavra + faixa] >> desloc;
+        if (desloc + b > 32) v |= empacotado[4 * (palavra + 1) + faixa] << (32 - desloc);
+        delta[i] = v & mascara;
+    }
+#endif
+}
+
+// Decodifica o bloco 'k' em 'chaves' e retorna quantas chaves ele tem
+static int comprimido_decodificar(const COMPRIMIDO *c, int k, int *chaves) {
+    const uint32_t *p = c->dados + c->inicio[k];
+    int b = (int)(p[0] & 0xFF), excecoes = (int)((p[0] >> 8) & 0xFF), n = (int)(p[0] >> 16);
+
+    uint32_t delta[COMPRIMIDO_BLOCO];
+    comprimido_desempacotar(p + 1, b, delta);
+    const uint32_t *excecao = p + 1 + 4 * b;
+    for (int e = 0; e < excecoes; e++) {
+        delta[excecao[2 * e]] |= excecao[2 * e + 1] << b;
+    }
+
+    // Soma de prefixos das diferenças a partir da primeira chave
+    uint32_t base = COMPRIMIDO_DESLOCAR(c->minimos[k]);
+#ifdef __SSE2__
+    __m128i soma = _mm_set1_epi32((int)base), sinal = _mm_set1_epi32((int)0x80000000u);
+    for (int i = 0; i < n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(delta + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, soma);
+        soma = _mm_shuffle_epi32(x, 0xFF);
+        _mm_storeu_si128((__m128i *)(delta + i), _mm_xor_si128(x, sinal));
+    }
+    memcpy(chaves, delta, n * sizeof(int));
+#else
+    for (int i = 0; i < n; i++) {
+        base += delta[i];
+        chaves[i] = COMPRIMIDO_VOLTAR(base);
+    }
+#endif
+    return n;
+}
+
+// Último bloco cuja primeira chave é <= 'chave', ou -1 se a chave vem antes de todos
+static int comprimido_bloco(const COMPRIMIDO *c, int chave) {
+    int ini = 0, fim = c->blocos - 1, achado = -1;
+    while (ini <= fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (c->minimos[meio] <= chave) {
+            achado = meio;
+            ini = meio + 1;
+        } else {
+            fim = meio - 1;
+        }
+    }
+    return achado;
+}
+
+//! Cria a representação comprimida a partir de chaves ordenadas
+COMPRIMIDO *comprimido_criar(const int *chaves, int n) {
+    for (int i = 1; i < n; i++) {
+        if (chaves[i - 1] >= chaves[i]) return NULL; // Fora de ordem ou repetida
+    }
+    COMPRIMIDO *c = comprimido_vazio();
+    for (int i = 0; c != NULL && i < n; i += COMPRIMIDO_BLOCO) {
+        int tamanho = n - i < COMPRIMIDO_BLOCO ? n - i : COMPRIMIDO_BLOCO;
+        if (!comprimido_acrescentar(c, chaves + i, tamanho)) comprimido_apagar(&c);
+    }
+    if (c != NULL) comprimido_ajustar(c);
+    return c;
+}
+
+//! Libera a representação
+void comprimido_apagar(COMPRIMIDO **c) {
+    if (c == NULL || *c == NULL) return;
+    if (--(*c)->ref == 0) {
+        free((*c)->minimos);
+        free((*c)->inicio);
+        free((*c)->dados);
+        free(*c);
+    }
+    *c = NULL;
+}
+
+//! Clona em O(1)
+COMPRIMIDO *comprimido_clonar(COMPRIMIDO *c) {
+    if (c != NULL) c->ref++;
+    return c;
+}
+
+//! Quantidade de chaves
+int comprimido_quantidade(COMPRIMIDO *c) {
+    return c ? c->n : 0;
+}
+
+//! Memória ocupada, em bytes
+size_t comprimido_bytes(COMPRIMIDO *c) {
+    if (c == NULL) return 0;
+    return sizeof(COMPRIMIDO) + c->capacidade * sizeof(uint32_t)
+           + (size_t)c->capacidade_blocos * (sizeof(int) + sizeof(uint32_t));
+}
+
+//! Verifica se a chave pertence: índice e um único bloco
+bool comprimido_pertence(COMPRIMIDO *c, int chave) {
+    if (c == NULL || c->n == 0 || chave > c->maximo) return false;
+    int k = comprimido_bloco(c, chave);
+    if (k < 0) return false;
+
+    int chaves[COMPRIMIDO_BLOCO];
+    int n = comprimido_decodificar(c, k, chaves);
+    int ini = 0, fim = n - 1;
+    while (ini <= fim) {
+        int meio = ini + (fim - ini) / 2;
+        if (chaves[meio] == chave) return true;
+        if (chaves[meio] < chave) ini = meio + 1;
+        else fim = meio - 1;
+    }
+    return false;
+}
+
+//! Menor chave
+bool comprimido_minimo(COMPRIMIDO *c, int *chave) {
+    if (c == NULL || c->n == 0) return false;
+    *chave = c->minimos[0];
+    return true;
+}
+
+//! Maior chave
+bool comprimido_maximo(COMPRIMIDO *c, int *chave) {
+    if (c == NULL || c->n == 0) return false;
+    *chave = c->maximo;
+    return true;
+}
+
+//! Menor chave >= 'chave'
+bool comprimido_teto(COMPRIMIDO *c, int chave, int *resultado) {
+    if (c == NULL || c->n == 0 || chave > c->maximo) return false;
+    int k = comprimido_bloco(c, chave);
+    if (k < 0) {
+        *resultado = c->minimos[0];
+        return true;
+    }
+    int chaves[COMPRIMIDO_BLOCO];
+    int n = comprimido_decodificar(c, k, chaves);
+    for (int i = 0; i < n; i++) {
+        if (chaves[i] >= chave) {
+            *resultado = chaves[i];
+            return true;
+        }
+    }
+    *resultado = c->minimos[k + 1]; // Existe, pois chave <= maximo
+    return true;
+}
+
+//! Maior chave <= 'chave'
+bool comprimido_piso(COMPRIMIDO *c, int chave, int *resultado) {
+    if (c == NULL || c->n == 0) return false;
+    int k = comprimido_bloco(c, chave);
+    if (k < 0) return false;
+    int chaves[COMPRIMIDO_BLOCO];
+    int n = comprimido_decodificar(c, k, chaves);
+    while (chaves[n - 1] > chave) n--; // A primeira chave do bloco é <= chave
+    *resultado = chaves[n - 1];
+    return true;
+}
+
+//! Imprime as chaves em ordem crescente, um bloco por vez
+void comprimido_imprimir(COMPRIMIDO *c) {
+    if (c == NULL || c->n == 0) {
+        printf("Arvore vazia.\n");
+        return;
+    }
+    int chaves[COMPRIMIDO_BLOCO];
+    for (int k = 0; k < c->blocos; k++) {
+        int n = comprimido_decodificar(c, k, chaves);
+        for (int i = 0; i < n; i++) printf("%d ", chaves[i]);
+    }
+}
+
+//! Decodifica todas as chaves
+void comprimido_extrair(COMPRIMIDO *c, int *chaves) {
+    for (int k = 0; c != NULL && k < c->blocos; k++) {
+        chaves += comprimido_decodificar(c, k, chaves);
+    }
+}
+
+//! Confere a ordem das chaves e o índice
+int comprimido_auditar(COMPRIMIDO *c) {
+    if (c == NULL) return 0;
+    int violacoes = 0, total = 0, chaves[COMPRIMIDO_BLOCO];
+    for (int k = 0; k < c->blocos; k++) {
+        int n = comprimido_decodificar(c, k, chaves);
+        if (chaves[0] != c->minimos[k]) violacoes++;
+        if (k > 0 && c->minimos[k - 1] >= chaves[0]) violacoes++;
+        for (int i = 1; i < n; i++) {
+            if (chaves[i - 1] >= chaves[i]) violacoes++;
+        }
+        if (k == c->blocos - 1 && chaves[n - 1] != c->maximo) violacoes++;
+        total += n;
+    }
+    if (total != c->n) violacoes++;
+    return violacoes;
+}
+
+//! Cria um iterador em ordem crescente
+COMPRIMIDO_ITERADOR *comprimido_iterador_criar(COMPRIMIDO *c) {
+    COMPRIMIDO_ITERADOR *it = (COMPRIMIDO_ITERADOR *)malloc(sizeof(COMPRIMIDO_ITERADOR));
+    if (it == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    it->c = c;
+    it->bloco = 0;
+    it->pos = it->quantidade = 0;
+    return it;
+}
+
+//! Próxima chave em ordem crescente
+bool comprimido_iterador_proximo(COMPRIMIDO_ITERADOR *it, int *chave) {
+    if (it == NULL || it->c == NULL) return false;
+    if (it->pos == it->quantidade) {
+        if (it->bloco >= it->c->blocos) return false;
+        it->quantidade = comprimido_decodificar(it->c, it->bloco++, it->chaves);
+        it->pos = 0;
+    }
+    *chave = it->chaves[it->pos++];
+    return true;
+}
+
+// Avança o iterador até a primeira chave >= 'chave', saltando pelo índice os blocos que
+// terminam antes dela; retorna false se não houver mais chaves
+static bool comprimido_iterador_saltar(COMPRIMIDO_ITERADOR *it, int chave, int *resultado) {
+    COMPRIMIDO *c = it->c;
+    if (it->pos == it->quantidade || it->chaves[it->quantidade - 1] < chave) {
+        // A chave está adiante do bloco atual: último bloco a partir do próximo que começa <= chave
+        int k = it->bloco;
+        while (k + 1 < c->blocos && c->minimos[k + 1] <= chave) k++;
+        if (k >= c->blocos) return false;
+        it->quantidade = comprimido_decodificar(c, k, it->chaves);
+        it->bloco = k + 1;
+        it->pos = 0;
+    }
+    while (it->pos < it->quantidade && it->chaves[it->pos] < chave) it->pos++;
+    return comprimido_iterador_proximo(it, resultado);
+}
+
+//! Libera o iterador
+void comprimido_iterador_apagar(COMPRIMIDO_ITERADOR **it) {
+    if (it == NULL || *it == NULL) return;
+    free(*it);
+    *it = NULL;
+}
+
+// Acumula chaves crescentes e comprime um bloco sempre que ele enche
+typedef struct {
+    COMPRIMIDO *c;
+    int chaves[COMPRIMIDO_BLOCO];
+    int n;
+    bool ok;
+} CONSTRUTOR;
+
+static void construtor_adicionar(CONSTRUTOR *k, int chave) {
+    k->chaves[k->n++] = chave;
+    if (k->n == COMPRIMIDO_BLOCO) {
+        k->ok = k->ok && comprimido_acrescentar(k->c, k->chaves, k->n);
+        k->n = 0;
+    }
+}
+
+static COMPRIMIDO *construtor_terminar(CONSTRUTOR *k) {
+    if (k->n > 0) k->ok = k->ok && comprimido_acrescentar(k->c, k->chaves, k->n);
+    if (!k->ok) comprimido_apagar(&k->c);
+    if (k->c != NULL) comprimido_ajustar(k->c);
+    return k->c;
+}
+
+//! União em fluxo: intercala os blocos decodificados e comprime o resultado
+COMPRIMIDO *comprimido_uniao(COMPRIMIDO *A, COMPRIMIDO *B) {
+    COMPRIMIDO_ITERADOR ia = {A, 0, 0, 0, {0}}, ib = {B, 0, 0, 0, {0}};
+    CONSTRUTOR k;
+    k.c = comprimido_vazio();
+    k.n = 0;
+    k.ok = k.c != NULL;
+    if (!k.ok) return NULL;
+
+    int a = 0, b = 0; // Só são lidas quando tem_a / tem_b
+    bool tem_a = comprimido_iterador_proximo(&ia, &a), tem_b = comprimido_iterador_proximo(&ib, &b);
+    while (tem_a || tem_b) {
+        if (tem_b && (!tem_a || b < a)) {
+            construtor_adicionar(&k, b);
+            tem_b = comprimido_iterador_proximo(&ib, &b);
+        } else {
+            construtor_adicionar(&k, a);
+            if (tem_b && a == b) tem_b = comprimido_iterador_proximo(&ib, &b);
+            tem_a = comprimido_iterador_proximo(&ia, &a);
+        }
+    }
+    return construtor_terminar(&k);
+}
+
+//! Interseção em fluxo: cada lado salta até a chave atual do outro
+COMPRIMIDO *comprimido_interseccao(COMPRIMIDO *A, COMPRIMIDO *B) {
+    COMPRIMIDO_ITERADOR ia = {A, 0, 0, 0, {0}}, ib = {B, 0, 0, 0, {0}};
+    CONSTRUTOR k;
+    k.c = comprimido_vazio();
+    k.n = 0;
+    k.ok = k.c != NULL;
+    if (!k.ok) return NULL;
+
+    int a, b;
+    bool tem = comprimido_iterador_proximo(&ia, &a) && comprimido_iterador_saltar(&ib, a, &b);
+    while (tem) {
+        if (a == b) {
+            construtor_adicionar(&k, a);
+            tem = comprimido_iterador_proximo(&ia, &a) && comprimido_iterador_saltar(&ib, a, &b);
+        } else if (a < b) {
+            tem = comprimido_iterador_saltar(&ia, b, &a);
+        } else {
+            tem = comprimido_iterador_saltar(&ib, a, &b);
+        }
+    }
+    return construtor_terminar(&k);
+}
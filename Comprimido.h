@@ -0,0 +1,70 @@
+#ifndef _CONJUNTO_COMPRIMIDO_H
+#define _CONJUNTO_COMPRIMIDO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Representação compacta e somente leitura de um conjunto de inteiros, para conjuntos que
+// ficam parados a maior parte do tempo mas precisam continuar residentes e consultáveis.
+// As chaves, em ordem, são divididas em blocos de COMPRIMIDO_BLOCO. Em cada bloco guardam-se
+// as diferenças entre chaves vizinhas empacotadas com a menor largura de bits que compensa;
+// as poucas diferenças maiores que essa largura viram exceções guardadas à parte (PFOR).
+// Um índice com a primeira chave de cada bloco leva direto ao único bloco que pode conter
+// uma chave. A decodificação de um bloco usa SSE2 quando disponível (com versão escalar).
+typedef struct comprimido COMPRIMIDO;
+
+// Iterador em ordem crescente, que decodifica um bloco por vez
+typedef struct comprimido_iterador COMPRIMIDO_ITERADOR;
+
+// Quantidade de chaves por bloco
+#define COMPRIMIDO_BLOCO 128
+
+// Cria a representação com as 'n' chaves, que devem estar em ordem estritamente crescente;
+// retorna NULL se a ordem não for respeitada ou faltar memória
+COMPRIMIDO *comprimido_criar(const int *chaves, int n);
+
+// Libera a representação (clones continuam válidos)
+void comprimido_apagar(COMPRIMIDO **c);
+
+// Retorna uma cópia em O(1); como nada muda depois de criado, os dados são compartilhados
+COMPRIMIDO *comprimido_clonar(COMPRIMIDO *c);
+
+// Quantidade de chaves e memória ocupada, em bytes
+int comprimido_quantidade(COMPRIMIDO *c);
+size_t comprimido_bytes(COMPRIMIDO *c);
+
+// Busca no índice e decodificação de um único bloco
+bool comprimido_pertence(COMPRIMIDO *c, int chave);
+
+// Menor e maior chave em O(1); retornam false se estiver vazio
+bool comprimido_minimo(COMPRIMIDO *c, int *chave);
+bool comprimido_maximo(COMPRIMIDO *c, int *chave);
+
+// Menor chave >= 'chave' (teto) e maior chave <= 'chave' (piso); false se não existir
+bool comprimido_teto(COMPRIMIDO *c, int chave, int *resultado);
+bool comprimido_piso(COMPRIMIDO *c, int chave, int *resultado);
+
+// União e interseção decodificando os blocos em fluxo e comprimindo o resultado
+// diretamente; a interseção salta pelo índice os blocos sem chaves em comum
+COMPRIMIDO *comprimido_uniao(COMPRIMIDO *A, COMPRIMIDO *B);
+COMPRIMIDO *comprimido_interseccao(COMPRIMIDO *A, COMPRIMIDO *B);
+
+// Imprime as chaves em ordem crescente
+void comprimido_imprimir(COMPRIMIDO *c);
+
+// Decodifica todas as chaves em 'chaves', que deve ter espaço para comprimido_quantidade(c)
+void comprimido_extrair(COMPRIMIDO *c, int *chaves);
+
+// Confere a ordem das chaves e o índice; retorna o número de violações
+int comprimido_auditar(COMPRIMIDO *c);
+
+// Cria um iterador em ordem crescente
+COMPRIMIDO_ITERADOR *comprimido_iterador_criar(COMPRIMIDO *c);
+
+// Obtém a próxima chave; retorna false quando não há mais chaves
+bool comprimido_iterador_proximo(COMPRIMIDO_ITERADOR *it, int *chave);
+
+// Libera o iterador
+void comprimido_iterador_apagar(COMPRIMIDO_ITERADOR **it);
+
+#endif
@@ -0,0 +1,119 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include "Concorrente.h"
+
+// Teste de carga do conjunto concorrente ("make concorrencia"): um escritor insere e remove
+// sem parar os números pares de [0, UNIVERSO) enquanto 1, 2, 4, ... leitores consultam o
+// conjunto. Os ímpares entram antes de tudo e nunca saem, e nada fora de [0, UNIVERSO) é
+// inserido, então todo leitor tem de ver sempre os ímpares e nunca os de fora; qualquer
+// outra resposta é uma violação. Para cada quantidade de leitores imprime as consultas por
+// segundo somadas e por leitor. Retorna 1 se houver violação ("make concorrencia_tsan" roda
+// o mesmo teste sob o ThreadSanitizer)
+
+#define UNIVERSO 100000 // Chaves manipuladas pelo escritor
+#define DURACAO_MS 300  // Duração de cada rodada
+#define MAX_THREADS 16  // Maior quantidade de leitores testada (padrão)
+
+typedef struct {
+    SET_CONC *s;
+    unsigned int semente;
+    long consultas;
+    long violacoes;
+} LEITOR;
+
+static atomic_int parar;
+
+static unsigned int sortear(unsigned int *estado) {
+    *estado ^= *estado << 13;
+    *estado ^= *estado >> 17;
+    *estado ^= *estado << 5;
+    return *estado;
+}
+
+static void *ler(void *arg) {
+    LEITOR *l = (LEITOR *)arg;
+    while (!atomic_load_explicit(&parar, memory_order_relaxed)) {
+        for (int i = 0; i < 256; i++) {
+            int chave = (int)(sortear(&l->semente) % (2 * UNIVERSO)) - UNIVERSO / 2;
+            bool pertence = set_conc_pertence(l->s, chave);
+            if (chave < 0 || chave >= UNIVERSO) {
+                if (pertence) l->violacoes++; // Nunca inserido
+            } else if (chave % 2 != 0 && !pertence) {
+                l->violacoes++; // Ímpares nunca saem
+            }
+        }
+        l->consultas += 256;
+    }
+    set_conc_liberar_thread();
+    return NULL;
+}
+
+static void *escrever(void *arg) {
+    SET_CONC *s = (SET_CONC *)arg;
+    unsigned int semente = 12345;
+    while (!atomic_load_explicit(&parar, memory_order_relaxed)) {
+        int chave = (int)(sortear(&semente) % (UNIVERSO / 2)) * 2;
+        if (!set_conc_inserir(s, chave)) set_conc_remover(s, chave);
+    }
+    return NULL;
+}
+
+// Uma rodada com 'n' leitores; soma as consultas e as violações
+static bool rodada(SET_CONC *s, int n, long *consultas, long *violacoes) {
+    pthread_t escritor, threads[MAX_THREADS];
+    LEITOR leitores[MAX_THREADS];
+
+    atomic_store(&parar, 0);
+    if (pthread_create(&escritor, NULL, escrever, s) != 0) return false;
+    int criadas = 0;
+    for (; criadas < n; criadas++) {
+        leitores[criadas] = (LEITOR){s, 2463534242u + 7919u * (unsigned int)criadas, 0, 0};
+        if (pthread_create(&threads[criadas], NULL, ler, &leitores[criadas]) != 0) break;
+    }
+
+    struct timespec espera = {DURACAO_MS / 1000, (DURACAO_MS % 1000) * 1000000L};
+    nanosleep(&espera, NULL);
+    atomic_store(&parar, 1);
+
+    pthread_join(escritor, NULL);
+    *consultas = *violacoes = 0;
+    for (int i = 0; i < criadas; i++) {
+        pthread_join(threads[i], NULL);
+        *consultas += leitores[i].consultas;
+        *violacoes += leitores[i].violacoes;
+    }
+    return criadas == n;
+}
+
+int main(int argc, char *argv[]) {
+    int max_leitores = argc > 1 ? atoi(argv[1]) : MAX_THREADS;
+    if (max_leitores < 1 || max_leitores > MAX_THREADS) {
+        fprintf(stderr, "Uso: %s [leitores, de 1 a %d]\n", argv[0], MAX_THREADS);
+        return 1;
+    }
+
+    SET_CONC *s = set_conc_criar();
+    if (s == NULL) return 1;
+    for (int i = 1; i < UNIVERSO; i += 2) set_conc_inserir(s, i);
+
+    long total_violacoes = 0;
+    for (int n = 1; n <= max_leitores; n *= 2) {
+        long consultas, violacoes;
+        if (!rodada(s, n, &consultas, &violacoes)) {
+            fprintf(stderr, "Erro ao criar as threads.\n");
+            set_conc_apagar(&s);
+            return 1;
+        }
+        double por_segundo = consultas * 1000.0 / DURACAO_MS;
+        printf("%2d leitores: %6.1f M consultas/s (%5.1f M por leitor), %ld violacoes\n", n, por_segundo / 1e6,
+               por_segundo / 1e6 / n, violacoes);
+        total_violacoes += violacoes;
+    }
+
+    set_conc_apagar(&s);
+    return total_violacoes > 0;
+}
@@ -0,0 +1,386 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "Concorrente.h"
+
+#define MAX_LEITORES 128  // Quantidade de threads leitoras registradas ao mesmo tempo
+#define LINHA_CACHE 64    // Tamanho da linha de cache, evita falso compartilhamento entre leitores
+
+// Nó da AVL concorrente. Depois de publicado, um nó nunca é alterado
+typedef struct no_conc NO_CONC;
+struct no_conc {
+    int chave;             // Chave do nó
+    int altura;            // Altura do nó (folha = 1)
+    unsigned long versao;  // Escrita que criou o nó; só essa escrita pode alterá-lo
+    NO_CONC *esq;          // Filho esquerdo
+    NO_CONC *dir;          // Filho direito
+};
+
+// Nó substituído aguardando que os leitores da sua época terminem
+typedef struct {
+    NO_CONC *no;
+    unsigned long epoca;
+} APOSENTADO;
+
+struct set_conc {
+    _Atomic(NO_CONC *) raiz;   // Versão publicada da árvore
+    pthread_mutex_t escrita;   // Serializa os escritores
+    unsigned long versao;      // Número da escrita em andamento
+    APOSENTADO *aposentados;   // Nós substituídos, em ordem crescente de época
+    size_t n_aposentados;
+    size_t cap_aposentados;
+    size_t inicio_escrita;     // Primeiro nó aposentado pela escrita em andamento
+    NO_CONC *reserva;          // Nós pré-alocados para a próxima cópia de caminho, ligados por esq
+    size_t n_reserva;
+};
+
+// Vaga de um leitor: a época em que ele entrou (0 se está fora de uma leitura)
+typedef struct {
+    _Alignas(LINHA_CACHE) atomic_ulong epoca;
+    atomic_int ocupada;
+} VAGA_LEITOR;
+
+static VAGA_LEITOR leitores[MAX_LEITORES];
+static atomic_ulong epoca_global = 1;
+static _Thread_local int vaga_thread = -1;
+
+// Obtém (registrando na primeira chamada) a vaga de leitor da thread atual
+static int conc_vaga_leitor(void) {
+    if (vaga_thread >= 0) return vaga_thread;
+
+    for (int i = 0; i < MAX_LEITORES; i++) {
+        int livre = 0;
+        if (atomic_compare_exchange_strong(&leitores[i].ocupada, &livre, 1)) {
+            vaga_thread = i;
+            return i;
+        }
+    }
+    return -1; // Todas as vagas ocupadas
+}
+
+//! Libera a vaga de leitor da thread atual
+void set_conc_liberar_thread(void) {
+    if (vaga_thread < 0) return;
+    atomic_store(&leitores[vaga_thread].epoca, 0);
+    atomic_store(&leitores[vaga_thread].ocupada, 0);
+    vaga_thread = -1;
+}
+
+// Entra em uma seção de leitura e retorna a raiz publicada
+static NO_CONC *conc_entrar(SET_CONC *s, int vaga) {
+    if (vaga < 0) {
+        // Sem vaga livre: o leitor cai para o caminho bloqueante do escritor
+        pthread_mutex_lock(&s->escrita);
+        return atomic_load_explicit(&s->raiz, memory_order_relaxed);
+    }
+    atomic_store(&leitores[vaga].epoca, atomic_load(&epoca_global));
+    return atomic_load(&s->raiz);
+}
+
+// Sai da seção de leitura
+static void conc_sair(SET_CONC *s, int vaga) {
+    if (vaga < 0) {
+        pthread_mutex_unlock(&s->escrita);
+        return;
+    }
+    atomic_store_explicit(&leitores[vaga].epoca, 0, memory_order_release);
+}
+
+//! Cria um conjunto concorrente vazio
+SET_CONC *set_conc_criar(void) {
+    SET_CONC *s = (SET_CONC *)malloc(sizeof(SET_CONC));
+    if (s == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    atomic_init(&s->raiz, NULL);
+    pthread_mutex_init(&s->escrita, NULL);
+    s->versao = 0;
+    s->aposentados = NULL;
+    s->n_aposentados = s->cap_aposentados = 0;
+    s->inicio_escrita = 0;
+    s->reserva = NULL;
+    s->n_reserva = 0;
+    return s;
+}
+
+// Apaga recursivamente os nós de uma versão da árvore
+static void conc_apagar_no(NO_CONC *raiz) {
+    if (raiz == NULL) return;
+    conc_apagar_no(raiz->esq);
+    conc_apagar_no(raiz->dir);
+    free(raiz);
+}
+
+//! Apaga o conjunto concorrente
+void set_conc_apagar(SET_CONC **s) {
+    if (s == NULL || *s == NULL) return;
+
+    conc_apagar_no(atomic_load(&(*s)->raiz));
+    for (size_t i = 0; i < (*s)->n_aposentados; i++)
+        free((*s)->aposentados[i].no);
+    free((*s)->aposentados);
+    while ((*s)->reserva != NULL) {
+        NO_CONC *no = (*s)->reserva;
+        (*s)->reserva = no->esq;
+        free(no);
+    }
+    pthread_mutex_destroy(&(*s)->escrita);
+    free(*s);
+    *s = NULL;
+}
+
+// Garante, antes de a escrita alterar qualquer coisa, n nós na reserva e n vagas livres
+// para aposentar: uma cópia de caminho pela metade não pode ser publicada
+static bool conc_reservar(SET_CONC *s, size_t n) {
+    if (s->cap_aposentados - s->n_aposentados < n) {
+        size_t cap = s->cap_aposentados ? 2 * s->cap_aposentados : 64;
+        while (cap - s->n_aposentados < n) cap *= 2;
+        APOSENTADO *novo = (APOSENTADO *)realloc(s->aposentados, cap * sizeof(APOSENTADO));
+        if (novo == NULL) {
+            fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+            return false;
+        }
+        s->aposentados = novo;
+        s->cap_aposentados = cap;
+    }
+    while (s->n_reserva < n) {
+        NO_CONC *no = (NO_CONC *)malloc(sizeof(NO_CONC));
+        if (no == NULL) {
+            fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+            return false; // Os nós já obtidos ficam na reserva para a próxima escrita
+        }
+        no->esq = s->reserva;
+        s->reserva = no;
+        s->n_reserva++;
+    }
+    return true;
+}
+
+// Cria um nó pertencente à escrita em andamento, tirado da reserva
+static NO_CONC *conc_criar_no(SET_CONC *s, int chave) {
+    NO_CONC *no = s->reserva;
+    s->reserva = no->esq;
+    s->n_reserva--;
+    no->chave = chave;
+    no->altura = 1;
+    no->versao = s->versao;
+    no->esq = no->dir = NULL;
+    return no;
+}
+
+// Marca um nó publicado como substituído; ele será liberado depois dos leitores atuais
+static void conc_aposentar(SET_CONC *s, NO_CONC *no) {
+    s->aposentados[s->n_aposentados].no = no;
+    s->aposentados[s->n_aposentados].epoca = 0; // Definida ao publicar a escrita
+    s->n_aposentados++;
+}
+
+// Retorna uma versão do nó que a escrita atual pode alterar (copiando-o se já foi publicado)
+static NO_CONC *conc_mutavel(SET_CONC *s, NO_CONC *no) {
+    if (no == NULL || no->versao == s->versao) return no;
+
+    NO_CONC *copia = conc_criar_no(s, no->chave);
+    copia->altura = no->altura;
+    copia->esq = no->esq;
+    copia->dir = no->dir;
+    conc_aposentar(s, no);
+    return copia;
+}
+
+static int conc_altura(NO_CONC *no) {
+    return no ? no->altura : 0;
+}
+
+static void conc_atualizar_altura(NO_CONC *no) {
+    int he = conc_altura(no->esq), hd = conc_altura(no->dir);
+    no->altura = 1 + (he > hd ? he : hd);
+}
+
+// Limite de nós que uma escrita copia (e aposenta) em uma árvore com essa raiz: o
+// caminho até a chave, até dois nós fora dele por rebalanceamento em cada nível e a folha nova
+static size_t conc_limite_copias(NO_CONC *raiz) {
+    return 3 * (size_t)conc_altura(raiz) + 1;
+}
+
+static int conc_fator(NO_CONC *no) {
+    return no ? conc_altura(no->esq) - conc_altura(no->dir) : 0;
+}
+
+// Rotação simples à direita sobre cópias privadas dos nós envolvidos
+static NO_CONC *conc_rodar_dir(SET_CONC *s, NO_CONC *a) {
+    a = conc_mutavel(s, a);
+    NO_CONC *b = conc_mutavel(s, a->esq);
+    a->esq = b->dir;
+    b->dir = a;
+    conc_atualizar_altura(a);
+    conc_atualizar_altura(b);
+    return b;
+}
+
+// Rotação simples à esquerda sobre cópias privadas dos nós envolvidos
+static NO_CONC *conc_rodar_esq(SET_CONC *s, NO_CONC *a) {
+    a = conc_mutavel(s, a);
+    NO_CONC *b = conc_mutavel(s, a->dir);
+    a->dir = b->esq;
+    b->esq = a;
+    conc_atualizar_altura(a);
+    conc_atualizar_altura(b);
+    return b;
+}
+
+// Rebalanceia um nó já pertencente à escrita atual
+static NO_CONC *conc_balancear(SET_CONC *s, NO_CONC *raiz) {
+    conc_atualizar_altura(raiz);
+    int FB = conc_fator(raiz);
+
+    if (FB == 2) {
+        if (conc_fator(raiz->esq) < 0)
+            raiz->esq = conc_rodar_esq(s, raiz->esq);
+        raiz = conc_rodar_dir(s, raiz);
+    } else if (FB == -2) {
+        if (conc_fator(raiz->dir) > 0)
+            raiz->dir = conc_rodar_dir(s, raiz->dir);
+        raiz = conc_rodar_esq(s, raiz);
+    }
+    return raiz;
+}
+
+// Insere uma chave ausente copiando o caminho até a folha
+static NO_CONC *conc_inserir_no(SET_CONC *s, NO_CONC *raiz, int chave) {
+    if (raiz == NULL) return conc_criar_no(s, chave);
+
+    raiz = conc_mutavel(s, raiz);
+    if (chave < raiz->chave)
+        raiz->esq = conc_inserir_no(s, raiz->esq, chave);
+    else
+        raiz->dir = conc_inserir_no(s, raiz->dir, chave);
+    return conc_balancear(s, raiz);
+}
+
+// Remove uma chave presente copiando o caminho até ela
+static NO_CONC *conc_remover_no(SET_CONC *s, NO_CONC *raiz, int chave) {
+    raiz = conc_mutavel(s, raiz);
+
+    if (chave < raiz->chave) {
+        raiz->esq = conc_remover_no(s, raiz->esq, chave);
+    } else if (chave > raiz->chave) {
+        raiz->dir = conc_remover_no(s, raiz->dir, chave);
+    } else if (raiz->esq == NULL || raiz->dir == NULL) {
+        NO_CONC *filho = raiz->esq ? raiz->esq : raiz->dir;
+        free(raiz); // Cópia privada, nunca foi vista por leitores
+        return filho;
+    } else {
+        // Substitui pela menor chave da subárvore direita
+        NO_CONC *sucessor = raiz->dir;
+        while (sucessor->esq != NULL) sucessor = sucessor->esq;
+        raiz->chave = sucessor->chave;
+        raiz->dir = conc_remover_no(s, raiz->dir, sucessor->chave);
+    }
+    return conc_balancear(s, raiz);
+}
+
+// Busca sem efeitos colaterais em uma versão da árvore
+static bool conc_busca(NO_CONC *raiz, int chave) {
+    while (raiz != NULL) {
+        if (chave < raiz->chave) raiz = raiz->esq;
+        else if (chave > raiz->chave) raiz = raiz->dir;
+        else return true;
+    }
+    return false;
+}
+
+// Libera os nós aposentados que nenhum leitor ativo pode mais alcançar
+static void conc_recuperar(SET_CONC *s) {
+    unsigned long minima = atomic_load(&epoca_global);
+    for (int i = 0; i < MAX_LEITORES; i++) {
+        unsigned long e = atomic_load(&leitores[i].epoca);
+        if (e != 0 && e < minima) minima = e;
+    }
+
+    size_t i = 0;
+    while (i < s->n_aposentados && s->aposentados[i].epoca < minima) {
+        free(s->aposentados[i].no);
+        i++;
+    }
+    if (i > 0) {
+        memmove(s->aposentados, s->aposentados + i, (s->n_aposentados - i) * sizeof(APOSENTADO));
+        s->n_aposentados -= i;
+    }
+}
+
+// Publica a nova raiz, data os nós substituídos e tenta recuperar memória
+static void conc_publicar(SET_CONC *s, NO_CONC *nova_raiz) {
+    atomic_store(&s->raiz, nova_raiz);
+
+    // Leitores que entrarem a partir da próxima época já enxergam a nova raiz
+    unsigned long epoca = atomic_fetch_add(&epoca_global, 1);
+    for (size_t i = s->inicio_escrita; i < s->n_aposentados; i++)
+        s->aposentados[i].epoca = epoca;
+
+    conc_recuperar(s);
+}
+
+// Começa uma escrita: os nós criados a partir daqui pertencem a ela
+static void conc_iniciar_escrita(SET_CONC *s) {
+    pthread_mutex_lock(&s->escrita);
+    s->versao++;
+    s->inicio_escrita = s->n_aposentados;
+}
+
+//! Insere um elemento no conjunto concorrente
+bool set_conc_inserir(SET_CONC *s, int elemento) {
+    if (s == NULL) return false;
+
+    conc_iniciar_escrita(s);
+    NO_CONC *raiz = atomic_load_explicit(&s->raiz, memory_order_relaxed);
+    // Duplicata: nada a copiar; sem memória para a cópia, o conjunto não muda
+    bool inserido = !conc_busca(raiz, elemento) && conc_reservar(s, conc_limite_copias(raiz));
+    if (inserido)
+        conc_publicar(s, conc_inserir_no(s, raiz, elemento));
+    pthread_mutex_unlock(&s->escrita);
+    return inserido;
+}
+
+//! Remove um elemento do conjunto concorrente
+bool set_conc_remover(SET_CONC *s, int elemento) {
+    if (s == NULL) return false;
+
+    conc_iniciar_escrita(s);
+    NO_CONC *raiz = atomic_load_explicit(&s->raiz, memory_order_relaxed);
+    // Ausente: nada a copiar; sem memória para a cópia, o conjunto não muda
+    bool removido = conc_busca(raiz, elemento) && conc_reservar(s, conc_limite_copias(raiz));
+    if (removido)
+        conc_publicar(s, conc_remover_no(s, raiz, elemento));
+    pthread_mutex_unlock(&s->escrita);
+    return removido;
+}
+
+//! Verifica se um elemento pertence ao conjunto concorrente
+bool set_conc_pertence(SET_CONC *s, int elemento) {
+    if (s == NULL) return false;
+
+    int vaga = conc_vaga_leitor();
+    bool achou = conc_busca(conc_entrar(s, vaga), elemento);
+    conc_sair(s, vaga);
+    return achou;
+}
+
+// Imprime uma versão da árvore em ordem
+static void conc_imprimir_no(NO_CONC *raiz) {
+    if (raiz == NULL) return;
+    conc_imprimir_no(raiz->esq);
+    printf("%d ", raiz->chave);
+    conc_imprimir_no(raiz->dir);
+}
+
+//! Imprime os elementos do conjunto concorrente
+void set_conc_imprimir(SET_CONC *s) {
+    if (s == NULL) return;
+
+    int vaga = conc_vaga_leitor();
+    conc_imprimir_no(conc_entrar(s, vaga));
+    conc_sair(s, vaga);
+}
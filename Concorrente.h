@@ -0,0 +1,36 @@
+#ifndef _CONJUNTO_CONCORRENTE_H
+#define _CONJUNTO_CONCORRENTE_H
+
+#include <stdbool.h>
+
+// Conjunto concorrente para cargas de leitura predominante.
+// Leitores (set_conc_pertence, set_conc_imprimir) nunca bloqueiam: cada escrita copia
+// o caminho da raiz até o nó alterado em uma AVL e publica a nova raiz de forma atômica.
+// Os nós substituídos só são liberados quando nenhum leitor pode mais enxergá-los
+// (recuperação baseada em épocas). Escritores são serializados entre si.
+typedef struct set_conc SET_CONC;
+
+// Cria um conjunto concorrente vazio
+SET_CONC *set_conc_criar(void);
+
+// Libera o conjunto; não pode haver leitores ou escritores ativos nele
+void set_conc_apagar(SET_CONC **s);
+
+// Insere um elemento, retorna true se ele ainda não estava no conjunto (O(log n));
+// retorna false sem alterar o conjunto se faltar memória
+bool set_conc_inserir(SET_CONC *s, int elemento);
+
+// Remove um elemento, retorna true se ele estava no conjunto (O(log n));
+// retorna false sem alterar o conjunto se faltar memória
+bool set_conc_remover(SET_CONC *s, int elemento);
+
+// Verifica se um elemento pertence ao conjunto sem bloquear
+bool set_conc_pertence(SET_CONC *s, int elemento);
+
+// Imprime os elementos de uma versão consistente do conjunto em ordem crescente
+void set_conc_imprimir(SET_CONC *s);
+
+// Devolve a vaga de leitor ocupada pela thread atual; chamar antes da thread terminar
+void set_conc_liberar_thread(void);
+
+#endif
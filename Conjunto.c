@@ -1,34 +1,320 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "Conjunto.h"
 #include "AVL.h"
 #include "LLRB.h"
+#include "Splay.h"
+#include "Comprimido.h"
+#include "Filtro.h"
+
+#define SET_FILTRO_MINIMO 64 // Menor capacidade de um filtro
+
+// Capacidade do vetor embutido no próprio conjunto, onde ficam os conjuntos pequenos sem
+// cabeçalho de árvore nem nós (múltiplo de 4, a largura das comparações SSE2)
+#ifndef SET_PEQUENO
+#define SET_PEQUENO 32
+#endif
 
 struct set {
-    void *structure;   // Ponteiro para a estrutura interna (AVL ou LLRB)
-    unsigned char tipo; // Tipo da estrutura (AVL ou LLRB)
+    void *structure;   // Ponteiro para a estrutura interna (AVL, LLRB, splay ou comprimida)
+    unsigned char tipo; // Tipo da estrutura (AVL, LLRB, splay ou comprimida)
+    bool embutido;      // Os elementos estão em 'pequeno' e a árvore ainda não existe
+    int quantidade;     // Quantidade de elementos, ou -1 se não é conhecida (após uniões de árvores)
+    ALOCADOR *mem;      // Enquanto embutido, o alocador da futura árvore (NULL para malloc)
+    FILTRO *filtro;     // Filtro de pertinência, ou NULL se o conjunto não tiver
+    long long consultas, descartadas, falsos_positivos; // Contadores do filtro
+    int pequeno[SET_PEQUENO]; // Elementos em ordem crescente enquanto embutido
 };
 
-// Função para criar o conjunto, usando AVL ou LLRB
-SET *set_criar(unsigned char tipo) {
+struct set_iterador {
+    void *iterador;     // Iterador da estrutura interna (AVL, LLRB, splay ou comprimida)
+    unsigned char tipo; // Tipo da estrutura percorrida
+    const SET *embutido; // Conjunto embutido percorrido (NULL se for uma estrutura)
+    int posicao;        // Próximo elemento do vetor embutido
+};
+
+//! Conjunto embutido
+
+// Cria um conjunto embutido vazio; retém 'mem', que será usado se ele virar árvore
+static SET *set_embutido_criar(unsigned char tipo, ALOCADOR *mem) {
     SET *s = (SET *)malloc(sizeof(SET));
     if (!s) {
         fprintf(stderr, "Erro ao alocar memória para o conjunto.\n");
         return NULL;
     }
+    s->structure = NULL;
+    s->tipo = tipo;
+    s->embutido = true;
+    s->quantidade = 0;
+    s->mem = mem ? alocador_reter(mem) : NULL;
+    s->filtro = NULL;
+    s->consultas = s->descartadas = s->falsos_positivos = 0;
+    memset(s->pequeno, 0, sizeof(s->pequeno));
+    return s;
+}
 
-    s->tipo = tipo; // Define o tipo de estrutura (AVL ou LLRB)
+// Repete o maior elemento até o fim do grupo de 4 em que ele está, para que as comparações
+// SSE2 leiam grupos inteiros sem máscara: uma cópia do maior não muda a resposta de
+// "é igual a x?" e só conta como menor que x quando todos os elementos também contam
+static void set_embutido_preencher(SET *s) {
+    for (int i = s->quantidade; i > 0 && i % 4 != 0; i++) {
+        s->pequeno[i] = s->pequeno[s->quantidade - 1];
+    }
+}
 
-    // Aloca a estrutura interna dependendo do tipo
-    if (tipo == AVL_TYPE) {
-        s->structure = avl_criar();  // Cria a árvore AVL
-    } else if (tipo == LLRB_TYPE) {
-        s->structure = llrb_criar(); // Cria a árvore LLRB
-    } else {
-        free(s); // Libera o espaço alocado caso o tipo seja inválido
+// Quantidade de elementos do vetor embutido menores que 'x', que é a posição de 'x' nele.
+// Com SSE2 são 4 comparações por instrução, acumuladas sem desvios dependentes dos dados;
+// o vetor está em ordem, então os menores formam um prefixo
+static int set_embutido_posicao(const SET *s, int x) {
+#ifdef __SSE2__
+    __m128i chave = _mm_set1_epi32(x), menores = _mm_setzero_si128();
+    for (int i = 0; i < s->quantidade; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s->pequeno + i));
+        menores = _mm_sub_epi32(menores, _mm_cmplt_epi32(v, chave)); // Cada "menor" vale -1
+    }
+    menores = _mm_add_epi32(menores, _mm_shuffle_epi32(menores, 0x4E));
+    menores = _mm_add_epi32(menores, _mm_shuffle_epi32(menores, 0xB1));
+    int p = _mm_cvtsi128_si32(menores);
+    return p < s->quantidade ? p : s->quantidade; // As cópias do maior contam a mais
+#else
+    int menores = 0;
+    for (int i = 0; i < s->quantidade; i++) {
+        menores += s->pequeno[i] < x;
+    }
+    return menores;
+#endif
+}
+
+// Verifica se 'x' está no vetor embutido
+static bool set_embutido_contem(const SET *s, int x) {
+#ifdef __SSE2__
+    __m128i chave = _mm_set1_epi32(x), iguais = _mm_setzero_si128();
+    for (int i = 0; i < s->quantidade; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(s->pequeno + i));
+        iguais = _mm_or_si128(iguais, _mm_cmpeq_epi32(v, chave));
+    }
+    return _mm_movemask_epi8(iguais) != 0;
+#else
+    int p = set_embutido_posicao(s, x);
+    return p < s->quantidade && s->pequeno[p] == x;
+#endif
+}
+
+// Insere 'x' no vetor embutido, que precisa ter espaço se 'x' for novo
+static bool set_embutido_inserir(SET *s, int x) {
+    int p = set_embutido_posicao(s, x);
+    if (p < s->quantidade && s->pequeno[p] == x) return false;
+    memmove(s->pequeno + p + 1, s->pequeno + p, (s->quantidade - p) * sizeof(int));
+    s->pequeno[p] = x;
+    s->quantidade++;
+    set_embutido_preencher(s);
+    return true;
+}
+
+// Remove 'x' do vetor embutido
+static bool set_embutido_remover(SET *s, int x) {
+    int p = set_embutido_posicao(s, x);
+    if (p == s->quantidade || s->pequeno[p] != x) return false;
+    s->quantidade--;
+    memmove(s->pequeno + p, s->pequeno + p + 1, (s->quantidade - p) * sizeof(int));
+    set_embutido_preencher(s);
+    return true;
+}
+
+// Cria uma árvore vazia do tipo dado, com os nós vindos de 'mem' (NULL para malloc)
+static void *set_arvore_criar(unsigned char tipo, ALOCADOR *mem) {
+    if (tipo == AVL_TYPE) return mem ? (void *)avl_criar_com_alocador(mem) : (void *)avl_criar();
+    if (tipo == LLRB_TYPE) return mem ? (void *)llrb_criar_com_alocador(mem) : (void *)llrb_criar();
+    return mem ? (void *)splay_criar_com_alocador(mem) : (void *)splay_criar();
+}
+
+// Libera a árvore ou a representação comprimida do conjunto
+static void set_estrutura_apagar(SET *s) {
+    if (s->tipo == AVL_TYPE) avl_apagar((AVL **)&s->structure);
+    else if (s->tipo == LLRB_TYPE) llrb_apagar((LLRB **)&s->structure);
+    else if (s->tipo == SPLAY_TYPE) splay_apagar((SPLAY **)&s->structure);
+    else comprimido_apagar((COMPRIMIDO **)&s->structure);
+}
+
+// Passa os elementos do vetor embutido para uma árvore do tipo do conjunto, montada em O(n).
+// Retorna false, sem alterar o conjunto, se faltar memória
+static bool set_promover(SET *s) {
+    if (!s->embutido) return true;
+
+    void *arvore = set_arvore_criar(s->tipo, s->mem);
+    if (arvore == NULL) return false;
+    bool ok;
+    if (s->tipo == AVL_TYPE) ok = avl_carregar_ordenadas(arvore, s->pequeno, s->quantidade);
+    else if (s->tipo == LLRB_TYPE) ok = llrb_carregar_ordenadas(arvore, s->pequeno, s->quantidade);
+    else ok = splay_carregar_ordenadas(arvore, s->pequeno, s->quantidade);
+
+    s->structure = arvore;
+    if (!ok) {
+        set_estrutura_apagar(s);
+        return false;
+    }
+    alocador_soltar(&s->mem); // Agora é a árvore que retém o alocador
+    s->embutido = false;
+    return true;
+}
+
+// Volta para o vetor embutido uma árvore com no máximo SET_PEQUENO elementos e sem filtro
+// (o filtro só vale a pena em conjuntos grandes). Retorna false se faltar memória
+static bool set_rebaixar(SET *s) {
+    if (s->embutido || s->tipo == COMPRIMIDO_TYPE || s->filtro != NULL) return false;
+
+    int n = 0, elemento, copia[SET_PEQUENO];
+    SET_ITERADOR *it = set_iterador_criar(s);
+    if (it == NULL) return false;
+    while (n <= SET_PEQUENO && set_iterador_proximo(it, &elemento)) {
+        if (n < SET_PEQUENO) copia[n] = elemento;
+        n++;
+    }
+    set_iterador_apagar(&it);
+    if (n > SET_PEQUENO) return false;
+
+    // O conjunto guarda o alocador da árvore para quando voltar a crescer
+    ALOCADOR *mem;
+    if (s->tipo == AVL_TYPE) mem = avl_alocador(s->structure);
+    else if (s->tipo == LLRB_TYPE) mem = llrb_alocador(s->structure);
+    else mem = splay_alocador(s->structure);
+    s->mem = alocador_reter(mem);
+    set_estrutura_apagar(s);
+
+    memcpy(s->pequeno, copia, n * sizeof(int));
+    s->quantidade = n;
+    s->embutido = true;
+    set_embutido_preencher(s);
+    return true;
+}
+
+// Histerese: uma árvore só volta ao vetor com metade da capacidade dele, para que inserções
+// e remoções alternadas perto do limite não fiquem montando e desmontando árvores
+static void set_ajustar(SET *s) {
+    if (s != NULL && !s->embutido && s->quantidade >= 0 && s->quantidade <= SET_PEQUENO / 2) {
+        set_rebaixar(s);
+    }
+}
+
+// Conta os elementos percorrendo o conjunto
+static int set_contar(SET *s) {
+    if (s->embutido) return s->quantidade;
+
+    int n = 0, elemento;
+    SET_ITERADOR *it = set_iterador_criar(s);
+    if (it == NULL) return -1;
+    while (set_iterador_proximo(it, &elemento)) n++;
+    set_iterador_apagar(&it);
+    return n;
+}
+
+// Alocador de onde vêm (ou viriam) os nós do conjunto
+static ALOCADOR *set_alocador(SET *s) {
+    if (s->embutido) return s->mem;
+    if (s->tipo == AVL_TYPE) return avl_alocador(s->structure);
+    if (s->tipo == LLRB_TYPE) return llrb_alocador(s->structure);
+    if (s->tipo == SPLAY_TYPE) return splay_alocador(s->structure);
+    return NULL;
+}
+
+static SET *set_com_estrutura(unsigned char tipo, void *estrutura);
+
+// Função para criar o conjunto, usando AVL, LLRB ou splay
+SET *set_criar(unsigned char tipo) {
+    return set_criar_com_alocador(tipo, NULL); // malloc e free
+}
+
+// Função para criar o conjunto com os nós vindos de um alocador do usuário
+SET *set_criar_com_alocador(unsigned char tipo, const SET_ALOCADOR *alocador) {
+    if (tipo > COMPRIMIDO_TYPE) return NULL; // Tipo inválido
+    if (tipo == COMPRIMIDO_TYPE) {
+        if (alocador != NULL) return NULL; // Não há nós a alocar
+        SET *s = set_com_estrutura(tipo, comprimido_criar(NULL, 0)); // Conjunto comprimido vazio
+        if (s != NULL) s->quantidade = 0;
+        return s;
+    }
+
+    // AVL, LLRB e splay começam no vetor embutido: a árvore só é criada quando ele enche.
+    // A contabilidade dos bytes vivos só existe se houver alocador do usuário
+    ALOCADOR *mem = NULL;
+    if (alocador != NULL && (mem = alocador_criar(alocador)) == NULL) return NULL;
+    SET *s = set_embutido_criar(tipo, mem);
+    alocador_soltar(&mem); // O conjunto fica com a única referência
+    return s;
+}
+
+// Função auxiliar que envolve uma estrutura já construída em um conjunto
+static SET *set_com_estrutura(unsigned char tipo, void *estrutura) {
+    if (estrutura == NULL) return NULL;
+
+    SET *s = (SET *)malloc(sizeof(SET));
+    if (!s) {
+        fprintf(stderr, "Erro ao alocar memória para o conjunto.\n");
+        if (tipo == AVL_TYPE) avl_apagar((AVL **)&estrutura);
+        else if (tipo == LLRB_TYPE) llrb_apagar((LLRB **)&estrutura);
+        else if (tipo == SPLAY_TYPE) splay_apagar((SPLAY **)&estrutura);
+        else comprimido_apagar((COMPRIMIDO **)&estrutura);
         return NULL;
     }
+    s->tipo = tipo;
+    s->structure = estrutura;
+    s->embutido = false;
+    s->quantidade = -1;
+    s->mem = NULL;
+    s->filtro = NULL;
+    s->consultas = s->descartadas = s->falsos_positivos = 0;
+    return s;
+}
+
+// Refaz o filtro a partir dos elementos do conjunto, com folga para o dobro deles.
+// Retorna false, mantendo o filtro anterior, se faltar memória
+static bool set_refazer_filtro(SET *s) {
+    int n = 0, elemento;
+    SET_ITERADOR *it = set_iterador_criar(s);
+    if (it == NULL) return false;
+    while (set_iterador_proximo(it, &elemento)) n++;
+    set_iterador_apagar(&it);
+
+    FILTRO *f = filtro_criar(n < SET_FILTRO_MINIMO / 2 ? SET_FILTRO_MINIMO : n > INT_MAX / 2 ? INT_MAX : 2 * n);
+    it = set_iterador_criar(s);
+    if (f == NULL || it == NULL) {
+        filtro_apagar(&f);
+        set_iterador_apagar(&it);
+        return false;
+    }
+    while (set_iterador_proximo(it, &elemento)) filtro_adicionar(f, elemento);
+    set_iterador_apagar(&it);
+
+    filtro_apagar(&s->filtro);
+    s->filtro = f;
+    return true;
+}
 
+// Depois de uma operação em bloco o filtro antigo não vale mais: ele é refeito ou,
+// se faltar memória, descartado
+static void set_atualizar_filtro(SET *s) {
+    if (s == NULL || s->filtro == NULL) return;
+    if (!set_refazer_filtro(s)) filtro_apagar(&s->filtro);
+}
+
+// Um conjunto derivado de A (união, interseção) tem filtro se A tiver e se ele for árvore
+static SET *set_herdar_filtro(SET *A, SET *resultado) {
+    if (resultado != NULL && A->filtro != NULL && !resultado->embutido) set_refazer_filtro(resultado);
+    return resultado;
+}
+
+// Função para criar um conjunto com filtro de pertinência; ele nasce árvore e não usa o
+// vetor embutido, em que o filtro não pouparia nada
+SET *set_criar_com_filtro(unsigned char tipo) {
+    SET *s = set_criar(tipo);
+    if (s == NULL) return NULL;
+
+    if (!set_promover(s) || (s->filtro = filtro_criar(SET_FILTRO_MINIMO)) == NULL) set_apagar(&s);
     return s;
 }
 
@@ -36,49 +322,127 @@ SET *set_criar(unsigned char tipo) {
 bool set_inserir(SET *s, int elemento) {
     if (s == NULL) return false; // Retorna falso se o conjunto for nulo
 
+    if (s->embutido) {
+        if (s->quantidade < SET_PEQUENO || set_embutido_contem(s, elemento)) {
+            return set_embutido_inserir(s, elemento); // Cabe no vetor (ou já está nele)
+        }
+        if (!set_promover(s)) return false; // O vetor está cheio: passa para a árvore do tipo
+    }
+
+    bool inserido = false; // Continua falso caso o tipo seja inválido
     if (s->tipo == AVL_TYPE) {
-        return avl_inserir(s->structure, elemento); // Chama a função de inserção na árvore AVL
+        inserido = avl_inserir(s->structure, elemento); // Chama a função de inserção na árvore AVL
     } else if (s->tipo == LLRB_TYPE) {
-        return llrb_inserir(s->structure, elemento); // Chama a função de inserção na árvore LLRB
+        inserido = llrb_inserir(s->structure, elemento); // Chama a função de inserção na árvore LLRB
+    } else if (s->tipo == SPLAY_TYPE) {
+        inserido = splay_inserir(s->structure, elemento); // Chama a função de inserção na árvore splay
     }
-    return false; // Retorna falso caso o tipo seja inválido
+
+    if (inserido && s->quantidade >= 0) s->quantidade++;
+    if (inserido && s->filtro != NULL) {
+        filtro_adicionar(s->filtro, elemento);
+        // Cheio, o filtro dobra; se faltar memória ele continua correto, só menos seletivo
+        if (filtro_quantidade(s->filtro) > filtro_capacidade(s->filtro)) set_refazer_filtro(s);
+    }
+    return inserido;
 }
 
 // Função para remover um elemento do conjunto
 bool set_remover(SET *s, int elemento) {
     if (s == NULL) return false; // Retorna falso se o conjunto for nulo
+    if (s->embutido) return set_embutido_remover(s, elemento);
 
+    bool removido = false; // Continua falso caso o tipo seja inválido
     if (s->tipo == AVL_TYPE) {
-        return avl_remover(s->structure, elemento); // Chama a função de remoção na árvore AVL
+        removido = avl_remover(s->structure, elemento); // Chama a função de remoção na árvore AVL
     } else if (s->tipo == LLRB_TYPE) {
-        return llrb_remover(s->structure, elemento); // Chama a função de remoção na árvore LLRB
+        removido = llrb_remover(s->structure, elemento); // Chama a função de remoção na árvore LLRB
+    } else if (s->tipo == SPLAY_TYPE) {
+        removido = splay_remover(s->structure, elemento); // Chama a função de remoção na árvore splay
     }
-    return false; // Retorna falso caso o tipo seja inválido
+
+    if (removido && s->filtro != NULL) {
+        filtro_remover(s->filtro, elemento);
+        // Um filtro muito folgado é refeito menor, o que também limpa contadores saturados
+        if (filtro_capacidade(s->filtro) > SET_FILTRO_MINIMO &&
+            filtro_quantidade(s->filtro) < filtro_capacidade(s->filtro) / 8) {
+            set_refazer_filtro(s);
+        }
+    }
+    if (removido && s->quantidade >= 0) {
+        s->quantidade--;
+        set_ajustar(s); // Pequeno o bastante, volta ao vetor embutido
+    }
+    return removido;
 }
 
-// Função para verificar se um elemento pertence ao conjunto
-bool set_pertence(SET *A, int elemento) {
-    if (A == NULL) return false; // Retorna falso se o conjunto for nulo
+// Função auxiliar que procura o elemento no vetor embutido ou na estrutura interna
+static bool set_pertence_estrutura(SET *A, int elemento) {
+    if (A->embutido) return set_embutido_contem(A, elemento);
 
     if (A->tipo == AVL_TYPE) {
         return avl_busca(A->structure, elemento); // Busca o elemento na árvore AVL
     } else if (A->tipo == LLRB_TYPE) {
         return llrb_pertence(A->structure, elemento); // Busca o elemento na árvore LLRB
+    } else if (A->tipo == SPLAY_TYPE) {
+        return splay_pertence(A->structure, elemento); // Busca o elemento e o leva para a raiz
+    } else if (A->tipo == COMPRIMIDO_TYPE) {
+        return comprimido_pertence(A->structure, elemento); // Índice e um único bloco
     }
     return false; // Retorna falso caso o tipo seja inválido
 }
 
+// Função para verificar se um elemento pertence ao conjunto
+bool set_pertence(SET *A, int elemento) {
+    if (A == NULL) return false; // Retorna falso se o conjunto for nulo
+    if (A->filtro == NULL) return set_pertence_estrutura(A, elemento);
+
+    // O filtro responde sozinho a maior parte dos ausentes; o resto é confirmado na estrutura
+    A->consultas++;
+    if (!filtro_talvez_contem(A->filtro, elemento)) {
+        A->descartadas++;
+        return false;
+    }
+    if (!set_pertence_estrutura(A, elemento)) {
+        A->falsos_positivos++;
+        return false;
+    }
+    return true;
+}
+
 // Função para imprimir os elementos do conjunto
 void set_imprimir(SET *s) {
+    // Todas as formas imprimem em ordem crescente e, vazias, "Arvore vazia." (a LLRB não
+    // imprime nada, como llrb_imprimir)
+    if (s != NULL && s->embutido) {
+        if (s->quantidade == 0 && s->tipo != LLRB_TYPE) printf("Arvore vazia.\n");
+        for (int i = 0; i < s->quantidade; i++) {
+            printf("%d ", s->pequeno[i]);
+        }
+        return;
+    }
     if (s == NULL || s->structure == NULL) {
-        printf("Árvore vazia.\n"); // Informa que a árvore está vazia
+        printf("Arvore vazia.\n"); // Informa que a árvore está vazia
         return;
     }
 
     if (s->tipo == AVL_TYPE) {
-        avl_imprimir(s->structure);  // Chama a função de impressão específica da AVL
+        // avl_imprimir segue a pré-ordem da árvore; o iterador dá a ordem crescente
+        SET_ITERADOR *it = set_iterador_criar(s);
+        int elemento;
+        bool vazio = true;
+        while (set_iterador_proximo(it, &elemento)) {
+            printf("%d ", elemento);
+            vazio = false;
+        }
+        set_iterador_apagar(&it);
+        if (vazio) printf("Arvore vazia.\n");
     } else if (s->tipo == LLRB_TYPE) {
         llrb_imprimir(s->structure);  // Chama a função de impressão específica da LLRB
+    } else if (s->tipo == SPLAY_TYPE) {
+        splay_imprimir(s->structure); // Chama a função de impressão específica da splay
+    } else if (s->tipo == COMPRIMIDO_TYPE) {
+        comprimido_imprimir(s->structure); // Decodifica e imprime em ordem
     }
 }
 
@@ -86,55 +450,669 @@ void set_imprimir(SET *s) {
 void set_apagar(SET **s) {
     if (s == NULL || *s == NULL) return; // Verifica se o ponteiro é válido
 
-    if ((*s)->tipo == AVL_TYPE) {
+    if ((*s)->embutido) {
+        alocador_soltar(&(*s)->mem); // Não há árvore, só o alocador guardado para ela
+    } else if ((*s)->tipo == AVL_TYPE) {
         avl_apagar((AVL **)&(*s)->structure); // Libera a árvore AVL
     } else if ((*s)->tipo == LLRB_TYPE) {
         llrb_apagar((LLRB **)&(*s)->structure); // Libera a árvore LLRB
+    } else if ((*s)->tipo == SPLAY_TYPE) {
+        splay_apagar((SPLAY **)&(*s)->structure); // Libera a árvore splay
+    } else if ((*s)->tipo == COMPRIMIDO_TYPE) {
+        comprimido_apagar((COMPRIMIDO **)&(*s)->structure); // Libera a representação comprimida
     }
+    filtro_apagar(&(*s)->filtro);
 
     free(*s); // Libera o conjunto
     *s = NULL; // Define o ponteiro como nulo para evitar acessos inválidos
 }
 
-// Função para realizar a união de dois conjuntos (AVL ou LLRB)
+// Função para clonar um conjunto em O(1); os nós são compartilhados até serem alterados
+SET *set_clonar(SET *A) {
+    if (A == NULL) return NULL;
+
+    if (A->embutido) {
+        // Copiar o vetor já é O(1): são no máximo SET_PEQUENO elementos
+        SET *copia = set_embutido_criar(A->tipo, A->mem);
+        if (copia != NULL) {
+            copia->quantidade = A->quantidade;
+            memcpy(copia->pequeno, A->pequeno, sizeof(A->pequeno));
+        }
+        return copia;
+    }
+
+    SET *copia = NULL;
+    if (A->tipo == AVL_TYPE) {
+        copia = set_com_estrutura(A->tipo, avl_clonar(A->structure));
+    } else if (A->tipo == LLRB_TYPE) {
+        copia = set_com_estrutura(A->tipo, llrb_clonar(A->structure));
+    } else if (A->tipo == SPLAY_TYPE) {
+        copia = set_com_estrutura(A->tipo, splay_clonar(A->structure));
+    } else if (A->tipo == COMPRIMIDO_TYPE) {
+        copia = set_com_estrutura(A->tipo, comprimido_clonar(A->structure));
+    }
+    if (copia != NULL) copia->quantidade = A->quantidade;
+    if (copia != NULL && A->filtro != NULL) copia->filtro = filtro_clonar(A->filtro); // Mesmos elementos
+    return copia;
+}
+
+// Função para carregar o conjunto em bloco a partir de elementos já ordenados
+bool set_carregar_ordenados(SET *s, const int *elementos, int n) {
+    if (s == NULL) return false;
+
+    if (s->tipo != COMPRIMIDO_TYPE && n <= SET_PEQUENO && s->filtro == NULL) {
+        // Cabe no vetor embutido: confere a ordem e, se for árvore, descarta-a
+        for (int i = 1; i < n; i++) {
+            if (elementos[i - 1] >= elementos[i]) return false;
+        }
+        if (!s->embutido) {
+            s->mem = alocador_reter(set_alocador(s));
+            set_estrutura_apagar(s);
+            s->embutido = true;
+        }
+        if (n > 0) memcpy(s->pequeno, elementos, n * sizeof(int));
+        s->quantidade = n;
+        set_embutido_preencher(s);
+        return true;
+    }
+    if (!set_promover(s)) return false; // Grande demais para o vetor embutido
+
+    bool ok;
+    if (s->tipo == AVL_TYPE) {
+        ok = avl_carregar_ordenadas(s->structure, elementos, n);
+    } else if (s->tipo == LLRB_TYPE) {
+        ok = llrb_carregar_ordenadas(s->structure, elementos, n);
+    } else if (s->tipo == SPLAY_TYPE) {
+        ok = splay_carregar_ordenadas(s->structure, elementos, n);
+    } else {
+        // Comprimido: monta outra representação e só troca se der certo
+        COMPRIMIDO *c = comprimido_criar(elementos, n);
+        ok = c != NULL;
+        if (ok) {
+            comprimido_apagar((COMPRIMIDO **)&s->structure);
+            s->structure = c;
+        }
+    }
+    if (ok) {
+        s->quantidade = n;
+        set_atualizar_filtro(s);
+    }
+    return ok;
+}
+
+// União em que ao menos um dos conjuntos é embutido
+static SET *set_uniao_embutido(SET *A, SET *B) {
+    if (A->embutido && B->embutido) {
+        // Intercala os dois vetores; o resultado volta ao vetor ou, se não couber, vira árvore
+        int uniao[2 * SET_PEQUENO], n = 0, i = 0, j = 0;
+        while (i < A->quantidade || j < B->quantidade) {
+            if (j == B->quantidade || (i < A->quantidade && A->pequeno[i] < B->pequeno[j])) {
+                uniao[n++] = A->pequeno[i++];
+            } else {
+                if (i < A->quantidade && A->pequeno[i] == B->pequeno[j]) i++;
+                uniao[n++] = B->pequeno[j++];
+            }
+        }
+        SET *resultado = set_embutido_criar(A->tipo, A->mem);
+        if (resultado != NULL && !set_carregar_ordenados(resultado, uniao, n)) set_apagar(&resultado);
+        return resultado;
+    }
+
+    // Um deles é árvore: o resultado parte de um clone dela e recebe os poucos elementos do
+    // outro, compartilhando com ela as subárvores que não mudaram. O filtro segue A: o clone
+    // de B não fica com o filtro dele, pois A, embutido, não tem
+    SET *arvore = A->embutido ? B : A, *pequeno = A->embutido ? A : B;
+    SET *resultado = set_clonar(arvore);
+    if (resultado != NULL && arvore == B) filtro_apagar(&resultado->filtro);
+    for (int i = 0; resultado != NULL && i < pequeno->quantidade; i++) {
+        // set_inserir também retorna false para um elemento repetido
+        int x = pequeno->pequeno[i];
+        if (!set_inserir(resultado, x) && !set_pertence_estrutura(resultado, x)) set_apagar(&resultado);
+    }
+    return resultado;
+}
+
+// Interseção em que ao menos um dos conjuntos é embutido: o resultado cabe no vetor
+static SET *set_interseccao_embutido(SET *A, SET *B) {
+    SET *pequeno = A->embutido ? A : B, *outro = A->embutido ? B : A;
+    SET *resultado = set_embutido_criar(A->tipo, set_alocador(A));
+    if (resultado == NULL) return NULL;
+    for (int i = 0; i < pequeno->quantidade; i++) {
+        if (set_pertence_estrutura(outro, pequeno->pequeno[i])) {
+            resultado->pequeno[resultado->quantidade++] = pequeno->pequeno[i];
+        }
+    }
+    set_embutido_preencher(resultado);
+    return resultado;
+}
+
+// Função para realizar a união de dois conjuntos (AVL, LLRB ou splay)
 SET *set_uniao(SET *A, SET *B) {
     // Verifica se algum dos conjuntos é nulo
     if (!A || !B) return NULL;
 
-    // Verifica se ambos os conjuntos têm o mesmo tipo (AVL ou LLRB)
+    // Verifica se ambos os conjuntos têm o mesmo tipo
     if (A->tipo != B->tipo) return NULL;
+    if (A->embutido || B->embutido) return set_uniao_embutido(A, B);
 
-    // Cria um novo conjunto para armazenar o resultado da união
-    SET *result = set_criar(A->tipo);
-    if (!result) return NULL; // Verifica se a alocação do conjunto resultante falhou
-
-    // União para árvores AVL (quando A->tipo == 0, indicando que A é uma árvore AVL)
-    if (A->tipo == 0) {  // Caso A seja uma árvore AVL
-        // Chama a função avl_uniao para realizar a união entre as árvores AVL
-        result->structure = avl_uniao(A->structure, B->structure);  
-    } else {  // Caso A seja uma árvore LLRB
-        // Insere os elementos de A no conjunto resultante utilizando a operação LLRB
-        llrb_inserir_em_conjunto((LLRB *)A->structure, result);
-        // Insere os elementos de B no conjunto resultante utilizando a operação LLRB
-        llrb_inserir_em_conjunto((LLRB *)B->structure, result);
+    // O resultado parte de A e compartilha com ele as subárvores que não mudaram
+    if (A->tipo == AVL_TYPE) {
+        return set_herdar_filtro(A, set_com_estrutura(A->tipo, avl_uniao(A->structure, B->structure)));
+    } else if (A->tipo == LLRB_TYPE) {
+        return set_herdar_filtro(A, set_com_estrutura(A->tipo, llrb_uniao(A->structure, B->structure)));
+    } else if (A->tipo == SPLAY_TYPE) {
+        return set_herdar_filtro(A, set_com_estrutura(A->tipo, splay_uniao(A->structure, B->structure)));
+    } else if (A->tipo == COMPRIMIDO_TYPE) {
+        return set_herdar_filtro(A, set_com_estrutura(A->tipo, comprimido_uniao(A->structure, B->structure)));
     }
-
-    // Retorna o conjunto resultante contendo a união dos dois conjuntos
-    return result;
+    return NULL;
 }
 
 // Função para realizar a interseção de dois conjuntos
 SET *set_interseccao(SET *A, SET *B) {
+    if (!A || !B) return NULL;
     if (A->tipo != B->tipo) return NULL; // Verifica se os conjuntos têm o mesmo tipo
+    if (A->embutido || B->embutido) return set_interseccao_embutido(A, B);
+
+    SET *resultado = NULL;
+    if (A->tipo == AVL_TYPE) {
+        resultado = set_com_estrutura(A->tipo, avl_interseccao(A->structure, B->structure)); // Interseção de árvores AVL
+    } else if (A->tipo == LLRB_TYPE) {
+        resultado = set_com_estrutura(A->tipo, llrb_interseccao(A->structure, B->structure)); // Interseção de árvores LLRB
+    } else if (A->tipo == SPLAY_TYPE) {
+        resultado = set_com_estrutura(A->tipo, splay_interseccao(A->structure, B->structure)); // Interseção de árvores splay
+    } else if (A->tipo == COMPRIMIDO_TYPE) {
+        resultado = set_com_estrutura(A->tipo, comprimido_interseccao(A->structure, B->structure)); // Interseção em fluxo
+    }
+    if (resultado == NULL) return NULL;
+
+    // A interseção já percorre A; contar o resultado não muda a ordem do custo, e uma
+    // interseção pequena volta ao vetor embutido
+    resultado->quantidade = set_contar(resultado);
+    set_herdar_filtro(A, resultado);
+    set_ajustar(resultado);
+    return resultado;
+}
 
-    SET *result = malloc(sizeof(SET)); // Aloca memória para o conjunto resultante
-    result->tipo = A->tipo; // Define o tipo com base nos conjuntos de entrada
+// Função para guardar em A a união de A e B
+bool set_uniao_em(SET *A, SET *B) {
+    if (!A || !B || A->tipo != B->tipo) return false;
+    if (A->tipo == COMPRIMIDO_TYPE) return false; // Conjunto comprimido é somente leitura
 
+    if (B->embutido) {
+        // Poucos elementos: inseridos um a um, sem remontar A
+        bool ok = true;
+        for (int i = 0; i < B->quantidade; i++) {
+            int x = B->pequeno[i];
+            if (!set_inserir(A, x) && !set_pertence_estrutura(A, x)) ok = false;
+        }
+        return ok;
+    }
+    if (!set_promover(A)) return false; // B é árvore: A também passa a ser
+
+    bool ok = false;
     if (A->tipo == AVL_TYPE) {
-        result->structure = avl_interseccao(A->structure, B->structure); // Interseção de árvores AVL
+        ok = avl_uniao_em(A->structure, B->structure);
     } else if (A->tipo == LLRB_TYPE) {
-        result->structure = llrb_interseccao(A->structure, B->structure); // Interseção de árvores LLRB
+        ok = llrb_uniao_em(A->structure, B->structure);
+    } else if (A->tipo == SPLAY_TYPE) {
+        ok = splay_uniao_em(A->structure, B->structure);
     }
+    A->quantidade = set_contar(A); // A operação já é O(n + m)
+    set_atualizar_filtro(A);
+    return ok;
+}
+
+// Função para guardar em A a interseção de A e B
+bool set_interseccao_em(SET *A, SET *B) {
+    if (!A || !B || A->tipo != B->tipo) return false;
+    if (A->tipo == COMPRIMIDO_TYPE) return false; // Conjunto comprimido é somente leitura
 
-    return result;
+    if (A->embutido) {
+        // Mantém no vetor de A, em ordem, os elementos que estão em B
+        int n = 0;
+        for (int i = 0; i < A->quantidade; i++) {
+            if (set_pertence_estrutura(B, A->pequeno[i])) A->pequeno[n++] = A->pequeno[i];
+        }
+        A->quantidade = n;
+        set_embutido_preencher(A);
+        return true;
+    }
+    if (B->embutido) {
+        // O resultado são os elementos de B que estão em A, que cabem no vetor embutido
+        int resultado[SET_PEQUENO], n = 0;
+        for (int i = 0; i < B->quantidade; i++) {
+            if (set_pertence_estrutura(A, B->pequeno[i])) resultado[n++] = B->pequeno[i];
+        }
+        return set_carregar_ordenados(A, resultado, n);
+    }
+
+    bool ok = false;
+    if (A->tipo == AVL_TYPE) {
+        ok = avl_interseccao_em(A->structure, B->structure);
+    } else if (A->tipo == LLRB_TYPE) {
+        ok = llrb_interseccao_em(A->structure, B->structure);
+    } else if (A->tipo == SPLAY_TYPE) {
+        ok = splay_interseccao_em(A->structure, B->structure);
+    }
+    A->quantidade = set_contar(A); // A operação já é O(n + m)
+    set_atualizar_filtro(A);
+    set_ajustar(A);
+    return ok;
+}
+
+// Função auxiliar que combina B em A consumindo B: a estrutura de B é apagada pela
+// operação da árvore e aqui só resta liberar o conjunto
+static bool set_combinar_consumindo(SET *A, SET **B, bool uniao) {
+    if (!A || !B || !*B || *B == A || A->tipo != (*B)->tipo) return false;
+    if (A->tipo == COMPRIMIDO_TYPE) return false; // Somente leitura
+
+    if (A->embutido || (*B)->embutido) {
+        // Com um vetor embutido não há nós a mover: combina e apaga B
+        bool ok = uniao ? set_uniao_em(A, *B) : set_interseccao_em(A, *B);
+        set_apagar(B);
+        return ok;
+    }
+
+    bool ok;
+    if (A->tipo == AVL_TYPE) {
+        AVL **b = (AVL **)&(*B)->structure;
+        ok = uniao ? avl_uniao_em_consumindo(A->structure, b) : avl_interseccao_em_consumindo(A->structure, b);
+    } else if (A->tipo == LLRB_TYPE) {
+        LLRB **b = (LLRB **)&(*B)->structure;
+        ok = uniao ? llrb_uniao_em_consumindo(A->structure, b) : llrb_interseccao_em_consumindo(A->structure, b);
+    } else {
+        SPLAY **b = (SPLAY **)&(*B)->structure;
+        ok = uniao ? splay_uniao_em_consumindo(A->structure, b) : splay_interseccao_em_consumindo(A->structure, b);
+    }
+    // A união só cresce e não volta ao vetor: deixa a quantidade desconhecida em vez de
+    // contar com um iterador, que alocaria
+    A->quantidade = uniao ? -1 : set_contar(A);
+    set_atualizar_filtro(A);
+    set_ajustar(A);
+    filtro_apagar(&(*B)->filtro);
+    free(*B);
+    *B = NULL;
+    return ok;
+}
+
+// Função para guardar em A a união de A e B, reaproveitando os nós de B
+bool set_uniao_em_consumindo(SET *A, SET **B) {
+    return set_combinar_consumindo(A, B, true);
+}
+
+// Função para guardar em A a interseção de A e B, liberando B
+bool set_interseccao_em_consumindo(SET *A, SET **B) {
+    return set_combinar_consumindo(A, B, false);
+}
+
+// Função para obter o menor elemento do conjunto
+bool set_minimo(SET *s, int *elemento) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        if (s->quantidade == 0) return false;
+        *elemento = s->pequeno[0];
+        return true;
+    }
+    if (s->tipo == AVL_TYPE) {
+        return avl_minimo(s->structure, elemento);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_minimo(s->structure, elemento);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_minimo(s->structure, elemento);
+    }
+    return comprimido_minimo(s->structure, elemento);
+}
+
+// Função para obter o maior elemento do conjunto
+bool set_maximo(SET *s, int *elemento) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        if (s->quantidade == 0) return false;
+        *elemento = s->pequeno[s->quantidade - 1];
+        return true;
+    }
+    if (s->tipo == AVL_TYPE) {
+        return avl_maximo(s->structure, elemento);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_maximo(s->structure, elemento);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_maximo(s->structure, elemento);
+    }
+    return comprimido_maximo(s->structure, elemento);
+}
+
+// Função para obter o menor elemento maior que o dado
+bool set_sucessor(SET *s, int elemento, int *resultado) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        int p = set_embutido_posicao(s, elemento);
+        if (p < s->quantidade && s->pequeno[p] == elemento) p++;
+        if (p == s->quantidade) return false;
+        *resultado = s->pequeno[p];
+        return true;
+    }
+    if (s->tipo == AVL_TYPE) {
+        return avl_sucessor(s->structure, elemento, resultado);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_sucessor(s->structure, elemento, resultado);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_sucessor(s->structure, elemento, resultado);
+    }
+    return elemento < INT_MAX && comprimido_teto(s->structure, elemento + 1, resultado);
+}
+
+// Função para obter o maior elemento menor que o dado
+bool set_antecessor(SET *s, int elemento, int *resultado) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        int p = set_embutido_posicao(s, elemento);
+        if (p == 0) return false;
+        *resultado = s->pequeno[p - 1];
+        return true;
+    }
+    if (s->tipo == AVL_TYPE) {
+        return avl_antecessor(s->structure, elemento, resultado);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_antecessor(s->structure, elemento, resultado);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_antecessor(s->structure, elemento, resultado);
+    }
+    return elemento > INT_MIN && comprimido_piso(s->structure, elemento - 1, resultado);
+}
+
+// Função para obter o maior elemento menor ou igual ao dado
+bool set_piso(SET *s, int elemento, int *resultado) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        int p = set_embutido_posicao(s, elemento);
+        if (p < s->quantidade && s->pequeno[p] == elemento) p++; // O próprio elemento conta
+        if (p == 0) return false;
+        *resultado = s->pequeno[p - 1];
+        return true;
+    }
+    if (s->tipo == AVL_TYPE) {
+        return avl_piso(s->structure, elemento, resultado);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_piso(s->structure, elemento, resultado);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_piso(s->structure, elemento, resultado);
+    }
+    return comprimido_piso(s->structure, elemento, resultado);
+}
+
+// Função para obter o menor elemento maior ou igual ao dado
+bool set_teto(SET *s, int elemento, int *resultado) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        int p = set_embutido_posicao(s, elemento);
+        if (p == s->quantidade) return false;
+        *resultado = s->pequeno[p];
+        return true;
+    }
+    if (s->tipo == AVL_TYPE) {
+        return avl_teto(s->structure, elemento, resultado);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_teto(s->structure, elemento, resultado);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_teto(s->structure, elemento, resultado);
+    }
+    return comprimido_teto(s->structure, elemento, resultado);
+}
+
+// Função para trocar a árvore do conjunto pela representação comprimida
+bool set_comprimir(SET *s) {
+    if (s == NULL) return false;
+    if (s->tipo == COMPRIMIDO_TYPE) return true;
+
+    // As chaves saem da árvore já em ordem
+    int n = 0, capacidade = 1024, elemento;
+    int *elementos = (int *)malloc(capacidade * sizeof(int));
+    SET_ITERADOR *it = set_iterador_criar(s);
+    if (elementos == NULL || it == NULL) {
+        fprintf(stderr, "Erro ao alocar memória para comprimir o conjunto.\n");
+        free(elementos);
+        set_iterador_apagar(&it);
+        return false;
+    }
+    while (set_iterador_proximo(it, &elemento)) {
+        if (n == capacidade) {
+            int *maior = (int *)realloc(elementos, 2 * capacidade * sizeof(int));
+            if (maior == NULL) {
+                fprintf(stderr, "Erro ao alocar memória para comprimir o conjunto.\n");
+                free(elementos);
+                set_iterador_apagar(&it);
+                return false;
+            }
+            elementos = maior;
+            capacidade *= 2;
+        }
+        elementos[n++] = elemento;
+    }
+    set_iterador_apagar(&it);
+
+    COMPRIMIDO *c = comprimido_criar(elementos, n);
+    free(elementos);
+    if (c == NULL) return false;
+
+    if (s->embutido) {
+        alocador_soltar(&s->mem);
+        s->embutido = false;
+    } else {
+        set_estrutura_apagar(s);
+    }
+    s->structure = c;
+    s->tipo = COMPRIMIDO_TYPE;
+    s->quantidade = n;
+    return true;
+}
+
+// Função para voltar de um conjunto comprimido para uma árvore
+bool set_descomprimir(SET *s, unsigned char tipo) {
+    if (s == NULL || tipo == COMPRIMIDO_TYPE) return false;
+    if (s->tipo != COMPRIMIDO_TYPE) return s->tipo == tipo;
+
+    int n = comprimido_quantidade(s->structure);
+    int *elementos = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
+    SET *arvore = set_criar(tipo);
+    if (elementos == NULL || arvore == NULL) {
+        free(elementos);
+        set_apagar(&arvore);
+        return false;
+    }
+    comprimido_extrair(s->structure, elementos);
+    bool ok = set_carregar_ordenados(arvore, elementos, n);
+    free(elementos);
+    // Conjunto com filtro não fica embutido
+    if (!ok || (s->filtro != NULL && !set_promover(arvore))) {
+        set_apagar(&arvore);
+        return false;
+    }
+
+    // O conjunto fica com a árvore (ou o vetor) montada, mantendo seu filtro e seus contadores;
+    // o invólucro temporário é descartado
+    comprimido_apagar((COMPRIMIDO **)&s->structure);
+    s->structure = arvore->structure;
+    s->tipo = tipo;
+    s->embutido = arvore->embutido;
+    s->quantidade = arvore->quantidade;
+    s->mem = arvore->mem;
+    memcpy(s->pequeno, arvore->pequeno, sizeof(s->pequeno));
+    free(arvore);
+    return true;
+}
+
+// Função para obter os bytes vivos usados pelo conjunto
+size_t set_memoria_usada(SET *s) {
+    if (s == NULL) return 0;
+
+    size_t proprio = sizeof(SET) + filtro_bytes(s->filtro);
+    if (s->embutido) {
+        return proprio + (s->mem ? alocador_em_uso(s->mem) : 0); // Nenhum nó: só o próprio conjunto
+    } else if (s->tipo == AVL_TYPE) {
+        return proprio + alocador_em_uso(avl_alocador(s->structure));
+    } else if (s->tipo == LLRB_TYPE) {
+        return proprio + alocador_em_uso(llrb_alocador(s->structure));
+    } else if (s->tipo == SPLAY_TYPE) {
+        return proprio + alocador_em_uso(splay_alocador(s->structure));
+    }
+    return proprio + comprimido_bytes(s->structure);
+}
+
+// Função para obter as estatísticas do conjunto e do seu filtro
+bool set_estatisticas(SET *s, SET_ESTATISTICAS *e) {
+    if (s == NULL || e == NULL) return false;
+
+    e->memoria = set_memoria_usada(s);
+    e->embutido = s->embutido;
+    e->elementos = s->quantidade;
+    e->filtro = s->filtro != NULL;
+    e->filtro_bytes = filtro_bytes(s->filtro);
+    e->consultas = s->consultas;
+    e->descartadas = s->descartadas;
+    e->falsos_positivos = s->falsos_positivos;
+    long long ausentes = s->descartadas + s->falsos_positivos; // Consultas de elementos fora do conjunto
+    e->taxa_falsos_positivos = ausentes ? (double)s->falsos_positivos / ausentes : 0.0;
+    return true;
+}
+
+// Função para auditar a forma da árvore do conjunto
+bool set_auditar(SET *s, FILE *saida) {
+    if (s == NULL) return false;
+
+    if (s->embutido) {
+        // Não há árvore: só a ordem do vetor pode estar errada
+        int violacoes = 0;
+        for (int i = 1; i < s->quantidade; i++) {
+            if (s->pequeno[i - 1] >= s->pequeno[i]) violacoes++;
+        }
+        if (saida != NULL) {
+            fprintf(saida, "%s embutido: %d elementos, %d violacoes\n",
+                    s->tipo == AVL_TYPE ? "AVL" : s->tipo == LLRB_TYPE ? "LLRB" : "Splay", s->quantidade, violacoes);
+        }
+        return violacoes == 0;
+    }
+
+    if (s->tipo == COMPRIMIDO_TYPE) {
+        // Não há árvore: a forma relevante é o espaço ocupado por chave
+        int violacoes = comprimido_auditar(s->structure), elementos = comprimido_quantidade(s->structure);
+        size_t bytes = comprimido_bytes(s->structure);
+        if (saida != NULL) {
+            fprintf(saida, "Comprimido: %d elementos, %zu bytes (%.2f por elemento), %d violacoes\n",
+                    elementos, bytes, elementos ? (double)bytes / elementos : 0.0, violacoes);
+        }
+        return violacoes == 0;
+    }
+
+    int elementos, profundidade, violacoes;
+    if (s->tipo == AVL_TYPE) {
+        violacoes = avl_auditar(s->structure, &elementos, &profundidade);
+    } else if (s->tipo == LLRB_TYPE) {
+        violacoes = llrb_auditar(s->structure, &elementos, &profundidade);
+    } else {
+        violacoes = splay_auditar(s->structure, &elementos, &profundidade);
+    }
+
+    // Profundidade ótima: menor altura de uma árvore binária com 'elementos' nós
+    int otima = 0;
+    while ((1LL << otima) - 1 < elementos) otima++;
+
+    if (saida != NULL) {
+        fprintf(saida, "%s: %d elementos, profundidade %d (otima %d), %d violacoes\n",
+                s->tipo == AVL_TYPE ? "AVL" : s->tipo == LLRB_TYPE ? "LLRB" : "Splay", elementos, profundidade, otima, violacoes);
+    }
+    return violacoes == 0;
+}
+
+// Função para reconstruir a árvore do conjunto com balanceamento perfeito
+bool set_rebalancear(SET *s) {
+    if (s == NULL) return false;
+    if (s->embutido) return true; // O vetor não tem forma a corrigir
+
+    if (s->tipo == AVL_TYPE) {
+        return avl_rebalancear(s->structure);
+    } else if (s->tipo == LLRB_TYPE) {
+        return llrb_rebalancear(s->structure);
+    } else if (s->tipo == SPLAY_TYPE) {
+        return splay_rebalancear(s->structure);
+    }
+    return true; // Os blocos comprimidos não têm forma a corrigir
+}
+
+// Função para criar um iterador em ordem sobre o conjunto
+SET_ITERADOR *set_iterador_criar(SET *s) {
+    if (s == NULL) return NULL;
+
+    SET_ITERADOR *it = (SET_ITERADOR *)malloc(sizeof(SET_ITERADOR));
+    if (!it) {
+        fprintf(stderr, "Erro ao alocar memória para o iterador.\n");
+        return NULL;
+    }
+
+    it->tipo = s->tipo;
+    it->embutido = NULL;
+    it->posicao = 0;
+    if (s->embutido) {
+        it->embutido = s; // Percorre o vetor diretamente
+        it->iterador = NULL;
+        return it;
+    } else if (s->tipo == AVL_TYPE) {
+        it->iterador = avl_iterador_criar(s->structure);
+    } else if (s->tipo == LLRB_TYPE) {
+        it->iterador = llrb_iterador_criar(s->structure);
+    } else if (s->tipo == SPLAY_TYPE) {
+        it->iterador = splay_iterador_criar(s->structure);
+    } else {
+        it->iterador = comprimido_iterador_criar(s->structure);
+    }
+    if (it->iterador == NULL) {
+        free(it);
+        return NULL;
+    }
+    return it;
+}
+
+// Função para obter o próximo elemento do iterador
+bool set_iterador_proximo(SET_ITERADOR *it, int *elemento) {
+    if (it == NULL) return false;
+
+    if (it->embutido != NULL) {
+        if (it->posicao == it->embutido->quantidade) return false;
+        *elemento = it->embutido->pequeno[it->posicao++];
+        return true;
+    }
+
+    if (it->tipo == AVL_TYPE) {
+        return avl_iterador_proximo(it->iterador, elemento);
+    } else if (it->tipo == LLRB_TYPE) {
+        return llrb_iterador_proximo(it->iterador, elemento);
+    } else if (it->tipo == SPLAY_TYPE) {
+        return splay_iterador_proximo(it->iterador, elemento);
+    }
+    return comprimido_iterador_proximo(it->iterador, elemento);
+}
+
+// Função para liberar o iterador
+void set_iterador_apagar(SET_ITERADOR **it) {
+    if (it == NULL || *it == NULL) return;
+
+    if ((*it)->embutido != NULL) {
+        // Nada a liberar além do próprio iterador
+    } else if ((*it)->tipo == AVL_TYPE) {
+        avl_iterador_apagar((AVL_ITERADOR **)&(*it)->iterador);
+    } else if ((*it)->tipo == LLRB_TYPE) {
+        llrb_iterador_apagar((LLRB_ITERADOR **)&(*it)->iterador);
+    } else if ((*it)->tipo == SPLAY_TYPE) {
+        splay_iterador_apagar((SPLAY_ITERADOR **)&(*it)->iterador);
+    } else {
+        comprimido_iterador_apagar((COMPRIMIDO_ITERADOR **)&(*it)->iterador);
+    }
+    free(*it);
+    *it = NULL;
 }
@@ -2,40 +2,174 @@
 #define _CONJUNTO_H
 
 #include <stdbool.h> 
+#include <stdio.h>
+#include <stddef.h>
+#include "Alocador.h"
 
 // Definição dos tipos de estruturas de dados suportadas
 #define AVL_TYPE 0    // Representa o tipo AVL (Árvore Balanceada)
 #define LLRB_TYPE 1   // Representa o tipo LLRB (Left-Leaning Red-Black Tree)
+#define SPLAY_TYPE 2  // Representa o tipo splay (árvore autoajustável, para acessos concentrados)
+#define COMPRIMIDO_TYPE 3 // Representa o tipo comprimido (blocos somente leitura, para conjuntos frios)
 
 // Tipo abstrato para representar um conjunto
 typedef struct set SET;
 
+// Iterador que percorre os elementos de um conjunto em ordem crescente
+typedef struct set_iterador SET_ITERADOR;
+
+// Estatísticas de um conjunto (veja set_estatisticas)
+typedef struct set_estatisticas {
+    size_t memoria;                // Bytes vivos, como em set_memoria_usada (inclui o filtro)
+    bool embutido;                 // Os elementos estão no vetor embutido no próprio conjunto
+    int elementos;                 // Quantidade de elementos, ou -1 se não for conhecida
+    bool filtro;                   // O conjunto tem filtro de pertinência
+    size_t filtro_bytes;           // Espaço ocupado pelo filtro
+    long long consultas;           // Chamadas a set_pertence que passaram pelo filtro
+    long long descartadas;         // Respondidas "não pertence" só pelo filtro
+    long long falsos_positivos;    // O filtro deixou passar e o elemento não estava no conjunto
+    double taxa_falsos_positivos;  // falsos_positivos / (descartadas + falsos_positivos)
+} SET_ESTATISTICAS;
+
 //! Operações básicas
 
-// Cria um novo conjunto com o tipo especificado (AVL ou LLRB)
+// Cria um novo conjunto com o tipo especificado (AVL, LLRB, splay ou comprimido, que nasce vazio).
+// Conjuntos pequenos não alocam árvore: até 32 elementos ficam em um vetor ordenado dentro
+// do próprio conjunto, consultado com comparações SIMD. Ao passar disso o conjunto vira a
+// árvore do tipo escolhido, e volta ao vetor quando cai para 16 elementos ou menos. O tipo
+// continua o mesmo para todas as funções, e nenhuma delas distingue as duas formas
 SET *set_criar(unsigned char tipo);
 
+// Cria um conjunto cujos nós e cabeçalhos de árvore vêm do alocador dado (copiado; o
+// 'contexto' precisa continuar válido enquanto o conjunto e seus derivados existirem).
+// Clones e resultados de operações sobre o conjunto usam o mesmo alocador, que só é chamado
+// quando o conjunto deixa o vetor embutido. Retorna NULL para o tipo comprimido, que não
+// usa nós
+SET *set_criar_com_alocador(unsigned char tipo, const SET_ALOCADOR *alocador);
+
+// Cria um conjunto com um filtro de pertinência na frente da estrutura (veja Filtro.h):
+// set_pertence de um elemento ausente costuma ser respondido lendo uma única linha de cache,
+// sem descer a árvore, ao custo de cerca de 5 bytes por elemento. O filtro é mantido por
+// set_inserir e set_remover, refeito pelas operações em bloco e herdado por clones. Um
+// resultado de união ou interseção tem filtro só se A tiver e o resultado for árvore (o
+// filtro de B não conta, e um resultado pequeno fica no vetor embutido). Se faltar memória
+// para refazê-lo, o conjunto segue sem filtro
+SET *set_criar_com_filtro(unsigned char tipo);
+
 // Insere um elemento no conjunto, retorna true se a inserção for bem-sucedida
+// (false se o elemento já estava no conjunto ou se o conjunto for comprimido; nesse caso
+// nada é alocado ou alterado)
 bool set_inserir(SET *s, int elemento);
 
 // Remove todos os elementos do conjunto e libera a memória
 void set_apagar(SET **s);
 
 // Remove um elemento específico do conjunto, retorna true se for removido
+// (false se o elemento não estava no conjunto ou se ele for comprimido; nesse caso a
+// estrutura não é alterada)
 bool set_remover(SET *s, int elemento);
 
-// Imprime os elementos do conjunto em ordem crescente
+// Imprime os elementos do conjunto em ordem crescente, qualquer que seja o tipo ou a forma;
+// um conjunto vazio imprime "Arvore vazia." (o LLRB não imprime nada)
 void set_imprimir(SET *s);
 
+// Retorna uma cópia do conjunto em O(1); original e cópia compartilham os nós
+// e cada um copia apenas o caminho que alterar (conjuntos persistentes)
+SET *set_clonar(SET *A);
+
+// Substitui o conteúdo do conjunto pelos 'n' elementos de 'elementos', que devem estar em
+// ordem estritamente crescente, montando a árvore balanceada em O(n) (carga em bloco).
+// Retorna false, sem alterar o conjunto, se a ordem não for respeitada ou faltar memória
+bool set_carregar_ordenados(SET *s, const int *elementos, int n);
+
 //! Operações especiais
 
 // Verifica se um elemento está presente no conjunto
+// (no tipo splay, um elemento encontrado é levado para a raiz da árvore)
 bool set_pertence(SET *A, int elemento);
 
 // Retorna um novo conjunto que representa a união de A e B
+// (compartilha com A as subárvores que não mudaram), ou NULL se faltar memória
 SET *set_uniao(SET *A, SET *B);
 
 // Retorna um novo conjunto que representa a interseção de A e B
+// (compartilha com A as subárvores que não mudaram)
 SET *set_interseccao(SET *A, SET *B);
 
+// A passa a ser a união de A e B, sem criar outro conjunto: O(n + m), e a árvore de A
+// é remontada balanceada. B não é alterado. Retorna false se os tipos forem diferentes
+// ou se faltar memória. Conjuntos comprimidos não podem ser alterados por estas quatro
+bool set_uniao_em(SET *A, SET *B);
+
+// A passa a ser a interseção de A e B; os nós que saem de A são liberados de uma vez
+bool set_interseccao_em(SET *A, SET *B);
+
+// Como set_uniao_em, mas consome B: os nós de B são movidos para A (sem alocar nada)
+// ou liberados, e B é apagado (*B vira NULL). B deve ser diferente de A. Os nós só são
+// copiados se B usar outro alocador do usuário (outras funções ou outro contexto)
+bool set_uniao_em_consumindo(SET *A, SET **B);
+
+// Como set_interseccao_em, mas consome B, que é apagado (*B vira NULL)
+bool set_interseccao_em_consumindo(SET *A, SET **B);
+
+//! Ordem
+
+// Obtém em 'elemento' o menor (ou o maior) elemento do conjunto em O(1);
+// retorna false se o conjunto estiver vazio
+bool set_minimo(SET *s, int *elemento);
+bool set_maximo(SET *s, int *elemento);
+
+// Obtém em 'resultado' o vizinho de 'elemento' (que não precisa pertencer ao conjunto)
+// em O(log n); retornam false se ele não existir. Nenhuma delas reorganiza a árvore splay
+bool set_sucessor(SET *s, int elemento, int *resultado);   // menor elemento >  'elemento'
+bool set_antecessor(SET *s, int elemento, int *resultado); // maior elemento <  'elemento'
+bool set_piso(SET *s, int elemento, int *resultado);       // maior elemento <= 'elemento'
+bool set_teto(SET *s, int elemento, int *resultado);       // menor elemento >= 'elemento'
+
+//! Compressão
+
+// Troca a árvore do conjunto por blocos de diferenças empacotadas em bits, com um índice
+// das primeiras chaves (veja Comprimido.h): alguns bytes por elemento em vez de um nó por
+// elemento. O conjunto continua consultável (pertence, ordem, iteração, união e interseção
+// entre comprimidos) mas passa a ser somente leitura. Retorna true se já era comprimido
+bool set_comprimir(SET *s);
+
+// Volta um conjunto comprimido para uma árvore do tipo dado (AVL, LLRB ou splay), montada
+// balanceada em O(n). Retorna false, sem alterar o conjunto, se faltar memória ou se o
+// conjunto já for uma árvore de outro tipo
+bool set_descomprimir(SET *s, unsigned char tipo);
+
+//! Manutenção
+
+// Bytes vivos usados pelo conjunto: o próprio conjunto, seu filtro e os nós e cabeçalhos
+// contados pelo seu alocador. Como clones e resultados de operações compartilham nós com a origem,
+// eles compartilham também essa contagem, que soma tudo o que está vivo entre eles
+size_t set_memoria_usada(SET *s);
+
+// Preenche 'e' com a memória do conjunto e, se ele tiver filtro, com a taxa de falsos
+// positivos observada nas consultas. Retorna false se o conjunto for NULL
+bool set_estatisticas(SET *s, SET_ESTATISTICAS *e);
+
+// Verifica as invariantes da árvore do conjunto (alturas e balanceamento da AVL; cores e
+// altura negra da LLRB) e escreve em 'saida' (se não for NULL) a quantidade de elementos,
+// a profundidade real e a ótima, ceil(log2(n + 1)). Retorna true se não houver violações
+bool set_auditar(SET *s, FILE *saida);
+
+// Reconstrói a árvore do conjunto com balanceamento perfeito em O(n), útil depois de
+// grandes cargas. Os nós são remontados no lugar; só os que o conjunto divide com clones
+// são copiados antes. Retorna false (sem alterar os elementos) se faltar memória
+bool set_rebalancear(SET *s);
+
+//! Iteração
+
+// Cria um iterador em ordem crescente; o conjunto não pode ser alterado enquanto ele existir
+// (nem consultado com set_pertence, se for do tipo splay)
+SET_ITERADOR *set_iterador_criar(SET *s);
+
+// Obtém o próximo elemento em 'elemento'; retorna false quando não há mais elementos
+bool set_iterador_proximo(SET_ITERADOR *it, int *elemento);
+
+// Libera o iterador
+void set_iterador_apagar(SET_ITERADOR **it);
+
 #endif
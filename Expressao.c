@@ -0,0 +1,235 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Expressao.h"
+
+// Operadores possíveis em um nó da expressão
+#define EXPR_CONJUNTO 0     // Folha: um conjunto existente
+#define EXPR_UNIAO 1        // a ∪ b
+#define EXPR_INTERSECCAO 2  // a ∩ b
+#define EXPR_DIFERENCA 3    // a \ b
+
+struct set_expr {
+    unsigned char op;   // Operador do nó
+    SET *conjunto;      // Conjunto referenciado (apenas em folhas)
+    SET_EXPR *a, *b;    // Operandos (apenas em operadores)
+};
+
+// Cursor de avaliação: produz os elementos de uma subexpressão em ordem crescente
+typedef struct cursor CURSOR;
+struct cursor {
+    unsigned char op;      // Operador avaliado
+    SET_ITERADOR *it;      // Fluxo do conjunto (folhas)
+    CURSOR *a, *b;         // Cursores dos operandos
+    int va, vb;            // Elemento atual de cada operando
+    bool tem_a, tem_b;     // Se cada operando ainda tem elemento atual
+};
+
+// Função auxiliar que cria um nó da expressão
+static SET_EXPR *expr_criar(unsigned char op, SET *conjunto, SET_EXPR *a, SET_EXPR *b) {
+    SET_EXPR *e = (SET_EXPR *)malloc(sizeof(SET_EXPR));
+    if (!e) {
+        fprintf(stderr, "Erro ao alocar memória para a expressão.\n");
+        set_expr_apagar(&a);
+        set_expr_apagar(&b);
+        return NULL;
+    }
+    e->op = op;
+    e->conjunto = conjunto;
+    e->a = a;
+    e->b = b;
+    return e;
+}
+
+// Função auxiliar que cria um operador binário, verificando os operandos
+static SET_EXPR *expr_operador(unsigned char op, SET_EXPR *a, SET_EXPR *b) {
+    if (a == NULL || b == NULL) {
+        set_expr_apagar(&a);
+        set_expr_apagar(&b);
+        return NULL;
+    }
+    return expr_criar(op, NULL, a, b);
+}
+
+// Função para criar uma folha que referencia um conjunto
+SET_EXPR *set_expr_conjunto(SET *A) {
+    if (A == NULL) return NULL;
+    return expr_criar(EXPR_CONJUNTO, A, NULL, NULL);
+}
+
+// Função para criar a expressão de união
+SET_EXPR *set_expr_uniao(SET_EXPR *a, SET_EXPR *b) {
+    return expr_operador(EXPR_UNIAO, a, b);
+}
+
+// Função para criar a expressão de interseção
+SET_EXPR *set_expr_interseccao(SET_EXPR *a, SET_EXPR *b) {
+    return expr_operador(EXPR_INTERSECCAO, a, b);
+}
+
+// Função para criar a expressão de diferença
+SET_EXPR *set_expr_diferenca(SET_EXPR *a, SET_EXPR *b) {
+    return expr_operador(EXPR_DIFERENCA, a, b);
+}
+
+// Função para verificar a pertinência descendo pela expressão com curto-circuito
+bool set_expr_pertence(SET_EXPR *e, int elemento) {
+    if (e == NULL) return false;
+
+    switch (e->op) {
+        case EXPR_CONJUNTO:
+            return set_pertence(e->conjunto, elemento);
+        case EXPR_UNIAO:
+            return set_expr_pertence(e->a, elemento) || set_expr_pertence(e->b, elemento);
+        case EXPR_INTERSECCAO:
+            return set_expr_pertence(e->a, elemento) && set_expr_pertence(e->b, elemento);
+        case EXPR_DIFERENCA:
+            return set_expr_pertence(e->a, elemento) && !set_expr_pertence(e->b, elemento);
+    }
+    return false;
+}
+
+// Função auxiliar que libera um cursor e os cursores dos operandos
+static void cursor_apagar(CURSOR **c) {
+    if (c == NULL || *c == NULL) return;
+
+    set_iterador_apagar(&(*c)->it);
+    cursor_apagar(&(*c)->a);
+    cursor_apagar(&(*c)->b);
+    free(*c);
+    *c = NULL;
+}
+
+static bool cursor_proximo(CURSOR *c, int *elemento);
+
+// Função auxiliar que cria os cursores de uma expressão e posiciona os operandos
+static CURSOR *cursor_criar(SET_EXPR *e) {
+    CURSOR *c = (CURSOR *)calloc(1, sizeof(CURSOR));
+    if (!c) {
+        fprintf(stderr, "Erro ao alocar memória para a avaliação.\n");
+        return NULL;
+    }
+    c->op = e->op;
+
+    if (e->op == EXPR_CONJUNTO) {
+        c->it = set_iterador_criar(e->conjunto);
+        if (c->it == NULL) cursor_apagar(&c);
+        return c;
+    }
+
+    c->a = cursor_criar(e->a);
+    c->b = cursor_criar(e->b);
+    if (c->a == NULL || c->b == NULL) {
+        cursor_apagar(&c);
+        return NULL;
+    }
+    c->tem_a = cursor_proximo(c->a, &c->va);
+    c->tem_b = cursor_proximo(c->b, &c->vb);
+    return c;
+}
+
+// Função auxiliar que combina os fluxos ordenados dos operandos
+static bool cursor_proximo(CURSOR *c, int *elemento) {
+    switch (c->op) {
+        case EXPR_CONJUNTO:
+            return set_iterador_proximo(c->it, elemento);
+
+        case EXPR_UNIAO:
+            if (!c->tem_a && !c->tem_b) return false;
+            if (!c->tem_b || (c->tem_a && c->va < c->vb)) {
+                *elemento = c->va;
+                c->tem_a = cursor_proximo(c->a, &c->va);
+            } else if (!c->tem_a || c->vb < c->va) {
+                *elemento = c->vb;
+                c->tem_b = cursor_proximo(c->b, &c->vb);
+            } else { // Presente nos dois operandos: produz uma única vez
+                *elemento = c->va;
+                c->tem_a = cursor_proximo(c->a, &c->va);
+                c->tem_b = cursor_proximo(c->b, &c->vb);
+            }
+            return true;
+
+        case EXPR_INTERSECCAO:
+            while (c->tem_a && c->tem_b) {
+                if (c->va < c->vb) {
+                    c->tem_a = cursor_proximo(c->a, &c->va);
+                } else if (c->vb < c->va) {
+                    c->tem_b = cursor_proximo(c->b, &c->vb);
+                } else {
+                    *elemento = c->va;
+                    c->tem_a = cursor_proximo(c->a, &c->va);
+                    c->tem_b = cursor_proximo(c->b, &c->vb);
+                    return true;
+                }
+            }
+            return false; // Um dos operandos acabou: não há mais elementos comuns
+
+        case EXPR_DIFERENCA:
+            while (c->tem_a) {
+                if (c->tem_b && c->vb < c->va) {
+                    c->tem_b = cursor_proximo(c->b, &c->vb);
+                } else if (c->tem_b && c->vb == c->va) {
+                    c->tem_a = cursor_proximo(c->a, &c->va);
+                } else {
+                    *elemento = c->va;
+                    c->tem_a = cursor_proximo(c->a, &c->va);
+                    return true;
+                }
+            }
+            return false;
+    }
+    return false;
+}
+
+// Função para imprimir o resultado da expressão em ordem crescente
+void set_expr_imprimir(SET_EXPR *e) {
+    if (e == NULL) return;
+
+    CURSOR *c = cursor_criar(e);
+    int elemento;
+    while (c != NULL && cursor_proximo(c, &elemento)) {
+        printf("%d ", elemento);
+    }
+    cursor_apagar(&c);
+}
+
+// Função para construir um conjunto com o resultado da expressão. O fluxo já sai em ordem
+// crescente, então é juntado num vetor e carregado em bloco, sem uma inserção por elemento
+SET *set_expr_materializar(SET_EXPR *e, unsigned char tipo) {
+    if (e == NULL) return NULL;
+
+    int capacidade = 64, n = 0, elemento;
+    int *elementos = (int *)malloc(capacidade * sizeof(int));
+    SET *resultado = set_criar(tipo);
+    CURSOR *c = cursor_criar(e);
+    bool ok = elementos != NULL && resultado != NULL && c != NULL;
+    while (ok && cursor_proximo(c, &elemento)) {
+        if (n == capacidade) {
+            int *maior = (int *)realloc(elementos, 2 * capacidade * sizeof(int));
+            if (maior == NULL) {
+                ok = false;
+                break;
+            }
+            elementos = maior;
+            capacidade *= 2;
+        }
+        elementos[n++] = elemento;
+    }
+    ok = ok && set_carregar_ordenados(resultado, elementos, n);
+    cursor_apagar(&c);
+    free(elementos);
+    if (!ok) {
+        fprintf(stderr, "Erro ao alocar memória para materializar a expressão.\n");
+        set_apagar(&resultado);
+    }
+    return resultado;
+}
+
+// Função para liberar a expressão
+void set_expr_apagar(SET_EXPR **e) {
+    if (e == NULL || *e == NULL) return;
+
+    set_expr_apagar(&(*e)->a);
+    set_expr_apagar(&(*e)->b);
+    free(*e);
+    *e = NULL;
+}
@@ -0,0 +1,39 @@
+#ifndef _CONJUNTO_EXPRESSAO_H
+#define _CONJUNTO_EXPRESSAO_H
+
+#include <stdbool.h>
+#include "Conjunto.h"
+
+// Expressão preguiçosa sobre conjuntos, como (A ∪ B) ∩ C.
+// Montar a expressão não copia elementos: ela só guarda a árvore de operadores.
+// A avaliação percorre os conjuntos em ordem e combina os fluxos elemento a elemento,
+// e a pertinência desce pela expressão com curto-circuito. Nada é materializado até
+// set_expr_materializar ser chamada. Os conjuntos usados não podem ser alterados nem
+// apagados enquanto a expressão existir.
+typedef struct set_expr SET_EXPR;
+
+// Cria uma expressão folha que referencia (sem copiar) o conjunto A
+SET_EXPR *set_expr_conjunto(SET *A);
+
+// Cria a expressão a ∪ b; a nova expressão passa a ser dona de 'a' e 'b'
+SET_EXPR *set_expr_uniao(SET_EXPR *a, SET_EXPR *b);
+
+// Cria a expressão a ∩ b; a nova expressão passa a ser dona de 'a' e 'b'
+SET_EXPR *set_expr_interseccao(SET_EXPR *a, SET_EXPR *b);
+
+// Cria a expressão a \ b; a nova expressão passa a ser dona de 'a' e 'b'
+SET_EXPR *set_expr_diferenca(SET_EXPR *a, SET_EXPR *b);
+
+// Verifica se um elemento pertence ao resultado sem avaliar a expressão inteira
+bool set_expr_pertence(SET_EXPR *e, int elemento);
+
+// Imprime o resultado em ordem crescente, gerando um elemento por vez
+void set_expr_imprimir(SET_EXPR *e);
+
+// Constrói um conjunto do tipo indicado (AVL, LLRB, splay ou comprimido) com o resultado da expressão
+SET *set_expr_materializar(SET_EXPR *e, unsigned char tipo);
+
+// Libera a expressão e suas subexpressões (os conjuntos referenciados não são apagados)
+void set_expr_apagar(SET_EXPR **e);
+
+#endif
@@ -0,0 +1,438 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/resource.h>
+#include "Externo.h"
+
+#define EXTERNO_BLOCO (64 * 1024)         // Menor buffer, em bytes, de cada corrida intercalada
+#define EXTERNO_BYTES_POR_ELEMENTO 48     // Estimativa do custo de um elemento carregado em um SET
+#define EXTERNO_ARQUIVOS_FIXOS 8          // Descritores além das corridas: padrão, entrada, intercalação e folga
+
+// Leitor de inteiros em texto com buffer próprio
+typedef struct {
+    FILE *f;
+    char buf[EXTERNO_BLOCO];
+    size_t n, pos;
+} TEXTO;
+
+// Conjunto de corridas (arquivos temporários com inteiros ordenados e sem repetições)
+typedef struct {
+    FILE **f;
+    int n, capacidade;
+} CORRIDAS;
+
+// Leitor de uma corrida
+typedef struct {
+    FILE *f;
+    int *buf;
+    size_t n, pos, capacidade;
+} CORRIDA;
+
+// Intercalação de várias corridas em um único fluxo crescente e sem repetições
+typedef struct {
+    CORRIDA *corridas;
+    int *atual;      // Valor corrente de cada corrida
+    int *heap;       // Corridas ainda não esgotadas, ordenadas pelo valor corrente
+    int tamanho;     // Quantidade de corridas no heap
+    bool tem_ultimo; // Já emitiu algum valor
+    int ultimo;      // Último valor emitido, para descartar repetições entre corridas
+} FLUXO;
+
+// Destino dos elementos do resultado: um arquivo de texto ou um vetor para carga em bloco
+typedef struct {
+    FILE *saida;
+    char buf[EXTERNO_BLOCO];
+    size_t n;
+    int *elementos;
+    size_t quantidade, capacidade, limite;
+    long long total;
+} DESTINO;
+
+// Converte o nome da operação para a constante
+int externo_operacao(const char *nome) {
+    if (strcmp(nome, "uniao") == 0) return EXTERNO_UNIAO;
+    if (strcmp(nome, "interseccao") == 0) return EXTERNO_INTERSECCAO;
+    if (strcmp(nome, "diferenca") == 0) return EXTERNO_DIFERENCA;
+    return -1;
+}
+
+// Próximo caractere do texto, ou EOF
+static int texto_caractere(TEXTO *t) {
+    if (t->pos == t->n) {
+        t->n = fread(t->buf, 1, sizeof(t->buf), t->f);
+        t->pos = 0;
+        if (t->n == 0) return EOF;
+    }
+    return (unsigned char)t->buf[t->pos++];
+}
+
+// Lê o próximo inteiro; retorna 1 se leu, 0 no fim do arquivo e -1 se o valor for inválido
+static int texto_inteiro(TEXTO *t, int *valor) {
+    int c;
+    do {
+        c = texto_caractere(t);
+    } while (c == ' ' || c == '\n' || c == '\t' || c == '\r');
+    if (c == EOF) return 0;
+
+    bool negativo = (c == '-');
+    if (c == '-' || c == '+') c = texto_caractere(t);
+    if (c < '0' || c > '9') return -1;
+
+    long long v = 0;
+    while (c >= '0' && c <= '9') {
+        v = v * 10 + (c - '0');
+        if (v > (long long)INT_MAX + 1) return -1; // Fora do intervalo de int
+        c = texto_caractere(t);
+    }
+    if (c != EOF && c != ' ' && c != '\n' && c != '\t' && c != '\r') return -1;
+    if (negativo) v = -v;
+    if (v > INT_MAX) return -1;
+    *valor = (int)v;
+    return 1;
+}
+
+// Comparação de inteiros para o qsort
+static int externo_comparar(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+// Acrescenta uma corrida ao conjunto
+static bool corridas_adicionar(CORRIDAS *c, FILE *f) {
+    if (c->n == c->capacidade) {
+        int capacidade = c->capacidade ? 2 * c->capacidade : 16;
+        FILE **maior = (FILE **)realloc(c->f, capacidade * sizeof(FILE *));
+        if (maior == NULL) return false;
+        c->f = maior;
+        c->capacidade = capacidade;
+    }
+    c->f[c->n++] = f;
+    return true;
+}
+
+// Fecha (e com isso apaga) todas as corridas
+static void corridas_apagar(CORRIDAS *c) {
+    for (int i = 0; i < c->n; i++) fclose(c->f[i]);
+    free(c->f);
+    c->f = NULL;
+    c->n = c->capacidade = 0;
+}
+
+// Grava 'n' inteiros em uma nova corrida
+static FILE *corrida_gravar(const int *v, size_t n) {
+    FILE *f = tmpfile();
+    if (f == NULL) return NULL;
+    if (fwrite(v, sizeof(int), n, f) != n || fflush(f) != 0) {
+        fclose(f);
+        return NULL;
+    }
+    rewind(f);
+    return f;
+}
+
+// Próximo valor de uma corrida
+static bool corrida_proximo(CORRIDA *c, int *valor) {
+    if (c->pos == c->n) {
+        c->n = fread(c->buf, sizeof(int), c->capacidade, c->f);
+        c->pos = 0;
+        if (c->n == 0) return false;
+    }
+    *valor = c->buf[c->pos++];
+    return true;
+}
+
+// Desce a corrida na posição 'i' do heap até o lugar certo
+static void fluxo_descer(FLUXO *x, int i) {
+    for (;;) {
+        int menor = i, esq = 2 * i + 1, dir = esq + 1;
+        if (esq < x->tamanho && x->atual[x->heap[esq]] < x->atual[x->heap[menor]]) menor = esq;
+        if (dir < x->tamanho && x->atual[x->heap[dir]] < x->atual[x->heap[menor]]) menor = dir;
+        if (menor == i) return;
+        int troca = x->heap[i];
+        x->heap[i] = x->heap[menor];
+        x->heap[menor] = troca;
+        i = menor;
+    }
+}
+
+// Libera o fluxo (as corridas continuam abertas)
+static void fluxo_apagar(FLUXO *x) {
+    free(x->corridas);
+    free(x->atual);
+    free(x->heap);
+    memset(x, 0, sizeof(*x));
+}
+
+// Prepara a intercalação de 'k' corridas, cada uma com um buffer de 'capacidade' inteiros
+// tirados de 'area' (que deve ter k * capacidade inteiros)
+static bool fluxo_criar(FLUXO *x, FILE **arquivos, int k, int *area, size_t capacidade) {
+    memset(x, 0, sizeof(*x));
+    x->corridas = (CORRIDA *)malloc((k ? k : 1) * sizeof(CORRIDA));
+    x->atual = (int *)malloc((k ? k : 1) * sizeof(int));
+    x->heap = (int *)malloc((k ? k : 1) * sizeof(int));
+    if (x->corridas == NULL || x->atual == NULL || x->heap == NULL) {
+        fluxo_apagar(x);
+        return false;
+    }
+    for (int i = 0; i < k; i++) {
+        CORRIDA *c = &x->corridas[i];
+        c->f = arquivos[i];
+        c->buf = area + i * capacidade;
+        c->n = c->pos = 0;
+        c->capacidade = capacidade;
+        if (corrida_proximo(c, &x->atual[i])) x->heap[x->tamanho++] = i;
+    }
+    for (int i = x->tamanho / 2 - 1; i >= 0; i--) fluxo_descer(x, i);
+    return true;
+}
+
+// Próximo valor da intercalação, sem repetições
+static bool fluxo_proximo(FLUXO *x, int *valor) {
+    while (x->tamanho > 0) {
+        int i = x->heap[0];
+        int v = x->atual[i];
+        if (!corrida_proximo(&x->corridas[i], &x->atual[i])) {
+            x->heap[0] = x->heap[--x->tamanho]; // Corrida esgotada
+        }
+        fluxo_descer(x, 0);
+        if (!x->tem_ultimo || v != x->ultimo) {
+            x->tem_ultimo = true;
+            x->ultimo = v;
+            *valor = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Quantas corridas podem ser intercaladas de uma vez dentro do limite de memória e do
+// limite de arquivos abertos do processo
+static int externo_vias(size_t memoria) {
+    size_t vias = memoria / EXTERNO_BLOCO;
+    if (vias > 1024) vias = 1024;
+
+    // Cada corrida aberta é um descritor: cabem as vias, mais a corrida recém-gravada
+    struct rlimit limite;
+    if (getrlimit(RLIMIT_NOFILE, &limite) == 0 && limite.rlim_cur != RLIM_INFINITY) {
+        size_t arquivos = limite.rlim_cur > EXTERNO_ARQUIVOS_FIXOS ? limite.rlim_cur - EXTERNO_ARQUIVOS_FIXOS : 0;
+        if (vias > arquivos + 1) vias = arquivos + 1;
+    }
+    return vias < 3 ? 2 : (int)vias - 1; // Um bloco fica para a saída
+}
+
+// Intercala as 'grupo' primeiras corridas em uma só, usando como buffers os 'inteiros'
+// inteiros de 'area'
+static bool externo_reduzir(CORRIDAS *c, int grupo, int *area, size_t inteiros) {
+    size_t capacidade = inteiros / (grupo + 1);
+    FILE *f = tmpfile();
+    FLUXO x;
+    if (f == NULL || !fluxo_criar(&x, c->f, grupo, area, capacidade)) {
+        if (f != NULL) fclose(f);
+        fprintf(stderr, "Erro ao intercalar arquivos temporarios.\n");
+        return false;
+    }
+
+    int *saida = area + grupo * capacidade;
+    size_t n = 0;
+    bool ok = true;
+    int v;
+    while (ok && fluxo_proximo(&x, &v)) {
+        saida[n++] = v;
+        if (n == capacidade) {
+            ok = fwrite(saida, sizeof(int), n, f) == n;
+            n = 0;
+        }
+    }
+    ok = ok && fwrite(saida, sizeof(int), n, f) == n && fflush(f) == 0;
+    fluxo_apagar(&x);
+    if (!ok) {
+        fclose(f);
+        fprintf(stderr, "Erro ao gravar arquivo temporario.\n");
+        return false;
+    }
+    rewind(f);
+
+    // A nova corrida ocupa o lugar das intercaladas
+    for (int i = 0; i < grupo; i++) fclose(c->f[i]);
+    c->f[0] = f;
+    memmove(c->f + 1, c->f + grupo, (c->n - grupo) * sizeof(FILE *));
+    c->n -= grupo - 1;
+    return true;
+}
+
+// Intercala corridas, sempre do lado que tiver mais, até que as de A e as de B caibam
+// juntas em 'vias' arquivos abertos
+static bool externo_limitar(CORRIDAS *a, CORRIDAS *b, int vias, int *area, size_t inteiros) {
+    bool ok = true;
+    while (ok && a->n + b->n > vias) {
+        CORRIDAS *maior = (a->n >= b->n) ? a : b;
+        int grupo = maior->n < vias ? maior->n : vias;
+        if (grupo < 2) grupo = 2;
+        ok = externo_reduzir(maior, grupo, area, inteiros);
+    }
+    return ok;
+}
+
+// Lê o arquivo em blocos de até 'capacidade' inteiros; cada bloco é ordenado, perde as
+// repetições e vira uma corrida. Quando as corridas abertas (somadas às já geradas do outro
+// arquivo, 'outras') passam de 'vias', são intercaladas ali mesmo, com 'bloco' como buffer
+static bool externo_gerar_corridas(const char *arquivo, int *bloco, size_t capacidade, CORRIDAS *corridas,
+                                   CORRIDAS *outras, int vias) {
+    TEXTO *t = (TEXTO *)malloc(sizeof(TEXTO));
+    if (t == NULL) return false;
+    t->f = fopen(arquivo, "rb");
+    t->n = t->pos = 0;
+    if (t->f == NULL) {
+        fprintf(stderr, "Erro ao abrir o arquivo %s.\n", arquivo);
+        free(t);
+        return false;
+    }
+
+    bool ok = true;
+    int lido = 1;
+    while (ok && lido == 1) {
+        size_t n = 0;
+        while (n < capacidade && (lido = texto_inteiro(t, &bloco[n])) == 1) n++;
+        if (lido < 0) {
+            fprintf(stderr, "Erro: valor invalido em %s.\n", arquivo);
+            ok = false;
+            break;
+        }
+        if (n == 0) break;
+
+        qsort(bloco, n, sizeof(int), externo_comparar);
+        size_t unicos = 1;
+        for (size_t i = 1; i < n; i++) {
+            if (bloco[i] != bloco[unicos - 1]) bloco[unicos++] = bloco[i];
+        }
+        FILE *f = corrida_gravar(bloco, unicos);
+        if (f == NULL || !corridas_adicionar(corridas, f)) {
+            if (f != NULL) fclose(f);
+            fprintf(stderr, "Erro ao gravar arquivo temporario.\n");
+            ok = false;
+        }
+        ok = ok && externo_limitar(corridas, outras, vias, bloco, capacidade);
+    }
+    fclose(t->f);
+    free(t);
+    return ok;
+}
+
+// Entrega um elemento do resultado ao destino
+static bool destino_emitir(DESTINO *d, int v) {
+    d->total++;
+    if (d->saida != NULL) {
+        if (d->n + 16 > sizeof(d->buf)) {
+            if (fwrite(d->buf, 1, d->n, d->saida) != d->n) return false;
+            d->n = 0;
+        }
+        d->n += sprintf(d->buf + d->n, "%d\n", v);
+        return true;
+    }
+    if (d->quantidade == d->capacidade) {
+        if (d->quantidade == d->limite) return false; // O resultado não cabe na memória
+        size_t capacidade = d->capacidade ? 2 * d->capacidade : 1024;
+        if (capacidade > d->limite) capacidade = d->limite;
+        int *maior = (int *)realloc(d->elementos, capacidade * sizeof(int));
+        if (maior == NULL) return false;
+        d->elementos = maior;
+        d->capacidade = capacidade;
+    }
+    d->elementos[d->quantidade++] = v;
+    return true;
+}
+
+// Gera as corridas de A e B, que cabem todas abertas, e entrega ao destino o resultado
+// da operação sobre os dois fluxos
+static bool externo_executar(const char *arquivo_a, const char *arquivo_b, int operacao, size_t memoria, DESTINO *d) {
+    if (operacao < EXTERNO_UNIAO || operacao > EXTERNO_DIFERENCA) return false;
+    if (memoria < 4 * EXTERNO_BLOCO) memoria = 4 * EXTERNO_BLOCO;
+
+    // As corridas são intercaladas em passadas já durante a leitura, e as de A e B nunca
+    // passam de 'vias' arquivos abertos
+    CORRIDAS a = {NULL, 0, 0}, b = {NULL, 0, 0};
+    size_t capacidade = memoria / sizeof(int);
+    int vias = externo_vias(memoria);
+    int *bloco = (int *)malloc(capacidade * sizeof(int));
+    bool ok = bloco != NULL
+              && externo_gerar_corridas(arquivo_a, bloco, capacidade, &a, &b, vias)
+              && externo_gerar_corridas(arquivo_b, bloco, capacidade, &b, &a, vias);
+    free(bloco);
+
+    FLUXO fa, fb;
+    int *area = NULL;
+    if (ok) {
+        size_t por_corrida = memoria / sizeof(int) / (a.n + b.n + 1);
+        area = (int *)malloc(((a.n + b.n) * por_corrida + 1) * sizeof(int));
+        ok = area != NULL && fluxo_criar(&fa, a.f, a.n, area, por_corrida);
+        if (ok && !fluxo_criar(&fb, b.f, b.n, area + a.n * por_corrida, por_corrida)) {
+            fluxo_apagar(&fa);
+            ok = false;
+        }
+        if (!ok) fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+    }
+
+    if (ok) {
+        int x, y;
+        bool tem_a = fluxo_proximo(&fa, &x), tem_b = fluxo_proximo(&fb, &y);
+        while (ok && (tem_a || tem_b)) {
+            if (!tem_a && operacao != EXTERNO_UNIAO) break; // Só B restou: nada mais entra
+            if (!tem_b && operacao == EXTERNO_INTERSECCAO) break;
+
+            if (tem_b && (!tem_a || y < x)) {
+                if (operacao == EXTERNO_UNIAO) ok = destino_emitir(d, y);
+                tem_b = fluxo_proximo(&fb, &y);
+            } else if (!tem_b || x < y) {
+                if (operacao != EXTERNO_INTERSECCAO) ok = destino_emitir(d, x);
+                tem_a = fluxo_proximo(&fa, &x);
+            } else {
+                if (operacao != EXTERNO_DIFERENCA) ok = destino_emitir(d, x);
+                tem_a = fluxo_proximo(&fa, &x);
+                tem_b = fluxo_proximo(&fb, &y);
+            }
+        }
+        fluxo_apagar(&fa);
+        fluxo_apagar(&fb);
+    }
+    free(area);
+    corridas_apagar(&a);
+    corridas_apagar(&b);
+    return ok;
+}
+
+// Calcula A op B e grava o resultado em ordem crescente
+long long externo_operar(const char *arquivo_a, const char *arquivo_b, int operacao, size_t memoria, FILE *saida) {
+    if (saida == NULL) return -1;
+
+    DESTINO *d = (DESTINO *)calloc(1, sizeof(DESTINO));
+    if (d == NULL) return -1;
+    d->saida = saida;
+
+    bool ok = externo_executar(arquivo_a, arquivo_b, operacao, memoria, d);
+    ok = ok && fwrite(d->buf, 1, d->n, saida) == d->n && fflush(saida) == 0;
+    long long total = ok ? d->total : -1;
+    if (!ok) fprintf(stderr, "Erro na operacao externa.\n");
+    free(d);
+    return total;
+}
+
+// Calcula A op B e carrega o resultado em bloco no conjunto
+bool externo_carregar(const char *arquivo_a, const char *arquivo_b, int operacao, size_t memoria, SET *destino) {
+    if (destino == NULL) return false;
+
+    DESTINO *d = (DESTINO *)calloc(1, sizeof(DESTINO));
+    if (d == NULL) return false;
+    d->limite = memoria / 2 / EXTERNO_BYTES_POR_ELEMENTO;
+    if (d->limite > INT_MAX) d->limite = INT_MAX;
+
+    bool ok = externo_executar(arquivo_a, arquivo_b, operacao, memoria / 2, d);
+    if (!ok && d->quantidade == d->limite) {
+        fprintf(stderr, "Erro: o resultado nao cabe no limite de memoria; use a saida em fluxo.\n");
+    }
+    ok = ok && set_carregar_ordenados(destino, d->elementos, (int)d->quantidade);
+    free(d->elementos);
+    free(d);
+    return ok;
+}
@@ -0,0 +1,41 @@
+#ifndef _CONJUNTO_EXTERNO_H
+#define _CONJUNTO_EXTERNO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "Conjunto.h"
+
+// Operações de conjunto em memória externa, para entradas maiores que a RAM.
+// Cada entrada é um arquivo de inteiros em texto (separados por espaços ou quebras de
+// linha, com repetições e em qualquer ordem). A entrada é lida em blocos que cabem no
+// limite de memória; cada bloco é ordenado, sem repetições, e gravado em um arquivo
+// temporário (uma "corrida"). As corridas são então intercaladas (k vias, com um heap),
+// em passadas feitas já durante a leitura sempre que passam de k, e a operação é feita
+// sobre os dois fluxos ordenados. O uso de memória fica em torno de 'memoria' bytes, e o
+// de arquivos abertos em torno de k, qualquer que seja o tamanho das entradas; k respeita
+// também o limite de arquivos abertos do processo. Os temporários são criados com tmpfile().
+
+// Operações disponíveis
+#define EXTERNO_UNIAO 0       // A ∪ B
+#define EXTERNO_INTERSECCAO 1 // A ∩ B
+#define EXTERNO_DIFERENCA 2   // A - B
+
+// Limite de memória usado quando nenhum é informado (64 MB)
+#define EXTERNO_MEMORIA_PADRAO ((size_t)64 << 20)
+
+// Converte o nome da operação ("uniao", "interseccao" ou "diferenca") para a constante;
+// retorna -1 se o nome for desconhecido
+int externo_operacao(const char *nome);
+
+// Calcula A op B com cerca de 'memoria' bytes e grava o resultado em 'saida' em ordem
+// crescente, um elemento por linha. Retorna a quantidade de elementos gravados, ou -1
+// se um arquivo não puder ser lido ou tiver um valor inválido (mensagem em stderr)
+long long externo_operar(const char *arquivo_a, const char *arquivo_b, int operacao, size_t memoria, FILE *saida);
+
+// Calcula A op B como externo_operar e carrega o resultado em bloco no conjunto 'destino',
+// substituindo seu conteúdo. Metade de 'memoria' vai para a intercalação e a outra metade
+// limita o resultado; se ele não couber, retorna false sem alterar o conjunto
+bool externo_carregar(const char *arquivo_a, const char *arquivo_b, int operacao, size_t memoria, SET *destino);
+
+#endif
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "Filtro.h"
+
+#define FILTRO_PALAVRAS (FILTRO_BLOCO / 8)   // Palavras de 64 bits por bloco
+#define FILTRO_CONTADORES (FILTRO_BLOCO * 2) // Contadores de 4 bits por bloco
+#define FILTRO_POR_CHAVE 10                  // Contadores reservados por chave
+#define FILTRO_SATURADO 15                   // Maior valor de um contador
+
+struct filtro {
+    uint64_t *blocos; // 'n_blocos' blocos alinhados à linha de cache
+    void *memoria;    // Endereço devolvido pelo malloc, antes do alinhamento
+    uint32_t n_blocos;
+    int quantidade;   // Chaves marcadas
+    int capacidade;   // Chaves para as quais o filtro foi dimensionado
+};
+
+// Espalha os bits da chave (finalizador do splitmix64)
+static inline uint64_t filtro_hash(int chave) {
+    uint64_t h = (uint64_t)(uint32_t)chave + 0x9E3779B97F4A7C15ULL;
+    h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return h ^ (h >> 31);
+}
+
+// Bloco da chave: os 32 bits altos do hash escalados para [0, n_blocos) sem divisão
+static inline uint64_t *filtro_bloco(FILTRO *f, uint64_t h) {
+    return f->blocos + ((uint64_t)(uint32_t)(h >> 32) * f->n_blocos >> 32) * FILTRO_PALAVRAS;
+}
+
+// Posição da i-ésima sonda no bloco: 7 bits da parte baixa do hash, que quase não pesa
+// na escolha do bloco
+static inline unsigned filtro_sonda(uint64_t h, int i) {
+    return (unsigned)(h >> (7 * i)) % FILTRO_CONTADORES;
+}
+
+// Função para criar o filtro
+FILTRO *filtro_criar(int capacidade) {
+    if (capacidade < 1) capacidade = 1;
+
+    FILTRO *f = (FILTRO *)malloc(sizeof(FILTRO));
+    if (f == NULL) {
+        fprintf(stderr, "Erro ao alocar memória para o filtro.\n");
+        return NULL;
+    }
+    f->n_blocos = (uint32_t)(((uint64_t)capacidade * FILTRO_POR_CHAVE + FILTRO_CONTADORES - 1) / FILTRO_CONTADORES);
+    f->memoria = calloc((size_t)f->n_blocos * FILTRO_BLOCO + FILTRO_BLOCO - 1, 1);
+    if (f->memoria == NULL) {
+        fprintf(stderr, "Erro ao alocar memória para o filtro.\n");
+        free(f);
+        return NULL;
+    }
+    f->blocos = (uint64_t *)(((uintptr_t)f->memoria + FILTRO_BLOCO - 1) & ~(uintptr_t)(FILTRO_BLOCO - 1));
+    f->quantidade = 0;
+    f->capacidade = capacidade;
+    return f;
+}
+
+// Função para liberar o filtro
+void filtro_apagar(FILTRO **f) {
+    if (f == NULL || *f == NULL) return;
+    free((*f)->memoria);
+    free(*f);
+    *f = NULL;
+}
+
+// Função para copiar o filtro
+FILTRO *filtro_clonar(FILTRO *f) {
+    if (f == NULL) return NULL;
+
+    FILTRO *copia = filtro_criar(f->capacidade);
+    if (copia == NULL) return NULL;
+    memcpy(copia->blocos, f->blocos, (size_t)f->n_blocos * FILTRO_BLOCO);
+    copia->quantidade = f->quantidade;
+    return copia;
+}
+
+// Função para marcar uma chave
+void filtro_adicionar(FILTRO *f, int chave) {
+    if (f == NULL) return;
+
+    uint64_t h = filtro_hash(chave), *bloco = filtro_bloco(f, h);
+    for (int i = 0; i < FILTRO_SONDAS; i++) {
+        unsigned p = filtro_sonda(h, i), desloc = (p % 16) * 4;
+        if (((bloco[p / 16] >> desloc) & 0xF) != FILTRO_SATURADO) {
+            bloco[p / 16] += (uint64_t)1 << desloc;
+        }
+    }
+    f->quantidade++;
+}
+
+// Função para desmarcar uma chave; contadores saturados não são decrementados, pois não se
+// sabe mais quantas chaves eles contam
+void filtro_remover(FILTRO *f, int chave) {
+    if (f == NULL) return;
+
+    uint64_t h = filtro_hash(chave), *bloco = filtro_bloco(f, h);
+    for (int i = 0; i < FILTRO_SONDAS; i++) {
+        unsigned p = filtro_sonda(h, i), desloc = (p % 16) * 4;
+        uint64_t contador = (bloco[p / 16] >> desloc) & 0xF;
+        if (contador != 0 && contador != FILTRO_SATURADO) {
+            bloco[p / 16] -= (uint64_t)1 << desloc;
+        }
+    }
+    f->quantidade--;
+}
+
+// Função para consultar uma chave: só lê o bloco dela
+bool filtro_talvez_contem(FILTRO *f, int chave) {
+    if (f == NULL) return true;
+
+    uint64_t h = filtro_hash(chave), *bloco = filtro_bloco(f, h);
+    for (int i = 0; i < FILTRO_SONDAS; i++) {
+        unsigned p = filtro_sonda(h, i);
+        if (((bloco[p / 16] >> ((p % 16) * 4)) & 0xF) == 0) return false;
+    }
+    return true;
+}
+
+// Funções para obter a quantidade de chaves, a capacidade e o espaço ocupado
+int filtro_quantidade(FILTRO *f) {
+    return f ? f->quantidade : 0;
+}
+
+int filtro_capacidade(FILTRO *f) {
+    return f ? f->capacidade : 0;
+}
+
+size_t filtro_bytes(FILTRO *f) {
+    return f ? sizeof(FILTRO) + (size_t)f->n_blocos * FILTRO_BLOCO + FILTRO_BLOCO - 1 : 0;
+}
@@ -0,0 +1,42 @@
+#ifndef _CONJUNTO_FILTRO_H
+#define _CONJUNTO_FILTRO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Filtro de pertinência na frente de um conjunto, para responder a maior parte das buscas
+// de elementos ausentes sem descer a árvore. É um filtro de Bloom em blocos com contadores:
+// cada chave cai em um único bloco de FILTRO_BLOCO bytes (uma linha de cache) e incrementa
+// FILTRO_SONDAS contadores de 4 bits dentro dele, de modo que uma consulta lê uma só linha
+// e uma remoção apenas decrementa os mesmos contadores. Um contador que satura fica parado
+// (nunca é decrementado), o que pode aumentar os falsos positivos mas nunca cria um falso
+// negativo: "não contém" é sempre exato, "talvez contenha" precisa ser confirmado
+typedef struct filtro FILTRO;
+
+// Bytes por bloco e contadores marcados por chave
+#define FILTRO_BLOCO 64
+#define FILTRO_SONDAS 5
+
+// Cria um filtro vazio dimensionado para 'capacidade' chaves (10 contadores por chave,
+// cerca de 1% de falsos positivos quando cheio)
+FILTRO *filtro_criar(int capacidade);
+
+// Libera o filtro
+void filtro_apagar(FILTRO **f);
+
+// Retorna uma cópia independente do filtro
+FILTRO *filtro_clonar(FILTRO *f);
+
+// Marca e desmarca uma chave; 'remover' só pode ser chamado para chaves marcadas
+void filtro_adicionar(FILTRO *f, int chave);
+void filtro_remover(FILTRO *f, int chave);
+
+// Retorna false se a chave certamente não foi marcada
+bool filtro_talvez_contem(FILTRO *f, int chave);
+
+// Chaves marcadas, capacidade para a qual foi dimensionado e memória ocupada, em bytes
+int filtro_quantidade(FILTRO *f);
+int filtro_capacidade(FILTRO *f);
+size_t filtro_bytes(FILTRO *f);
+
+#endif
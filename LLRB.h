@@ -2,42 +2,92 @@
     #define ARVORE_BINARIA_LLRB  // Previne múltiplas inclusões deste arquivo de cabeçalho
 
     #include <stdbool.h>  // Inclui o tipo booleano padrão 'bool', 'true' e 'false'
-    #include "conjunto.h"  // Inclui o cabeçalho para a estrutura ou operações do 'SET
+    #include "Alocador.h"  // Inclui o alocador dos nós
 
     // Tipos definidos para a Árvore Binária de Busca Vermelha e Esquerda (LLRB) e seus nós
-    typedef struct arv_LLRB LLRB;  // Alias para a estrutura da árvore LLRB
-    typedef struct no_ NO;  // Alias para a estrutura do nó, que representa os nós da árvore
+    typedef struct llrb LLRB;  // Alias para a estrutura da árvore LLRB
+    typedef struct llrb_no NO;  // Alias para a estrutura do nó, que representa os nós da árvore
+    typedef struct llrb_iterador LLRB_ITERADOR;  // Iterador em ordem crescente sobre a árvore
 
-    // Protótipos das funções:
+    // Protótipos das funções (geradas a partir de LLRB_modelo.h para chaves int;
+    // outros tipos de chave estão em Chaves.h):
 
     // Função para criar uma nova árvore LLRB vazia
     LLRB* llrb_criar(void);
 
-    // Função para inserir uma chave ('chave') na árvore LLRB 'T'
+    // Função para criar uma árvore LLRB vazia cujos nós e cabeçalho vêm de 'mem'
+    LLRB* llrb_criar_com_alocador(ALOCADOR *mem);
+
+    // Função que retorna o alocador usado pela árvore
+    ALOCADOR* llrb_alocador(LLRB *T);
+
+    // Função para inserir uma chave ('chave') na árvore LLRB 'T' (false se ela já existir)
     bool llrb_inserir(LLRB *T, int chave);
 
     // Função para verificar se uma chave ('chave') existe na árvore LLRB 'T'
     bool llrb_pertence(LLRB *T, int chave);
 
-    // Função para remover uma chave ('chave') da árvore LLRB 'T'
+    // Função para remover uma chave ('chave') da árvore LLRB 'T' (false se ela não existir)
     bool llrb_remover(LLRB *T, int chave);
 
     // Função para apagar a árvore inteira e liberar a memória
     void llrb_apagar(LLRB **T);
 
+    // Função para clonar a árvore LLRB 'T' em O(1); os nós são compartilhados
+    // e copiados sob demanda quando uma das árvores for alterada
+    LLRB* llrb_clonar(LLRB *T);
+
+    // Função para calcular e retornar uma nova árvore LLRB contendo a união
+    // dos elementos de 'T1' e 'T2' (compartilha com 'T1' as subárvores que não mudaram)
+    LLRB* llrb_uniao(LLRB *T1, LLRB *T2);
+
     // Função para calcular e retornar uma nova árvore LLRB contendo a interseção
-    // dos elementos de duas árvores LLRB 'T1' e 'T2'
+    // dos elementos de duas árvores LLRB 'T1' e 'T2' (compartilha com 'T1' as subárvores que não mudaram)
     LLRB* llrb_interseccao(LLRB *T1, LLRB *T2);
 
-    // Função para inserir todos os elementos da árvore LLRB 'T' em um conjunto 's'
-    void llrb_inserir_em_conjunto(LLRB *T, SET *s);
+    // Funções para a união e a interseção dentro de 'A' em O(n + m), sem criar outra árvore;
+    // as versões "_consumindo" reaproveitam os nós de 'B' (sem alocar) e apagam 'B'
+    // (retornam false se faltar memória)
+    bool llrb_uniao_em(LLRB *A, LLRB *B);
+    bool llrb_interseccao_em(LLRB *A, LLRB *B);
+    bool llrb_uniao_em_consumindo(LLRB *A, LLRB **B);
+    bool llrb_interseccao_em_consumindo(LLRB *A, LLRB **B);
 
     // Função para imprimir os elementos da árvore LLRB 'T' de uma forma legível (provavelmente em ordem)
     void llrb_imprimir(LLRB *T);
 
-    // Função para percorrer uma árvore com raiz 'raizA' (do tipo 'NO') e inserir os elementos
-    // em duas outras árvores LLRB 'B' e 'C'. Esta função pode ser usada para mesclar árvores
-    // ou redistribuir os elementos entre elas.
-    void percorrer_e_inserir(NO* raizA, LLRB *B, LLRB *C);
+    // Função para verificar as invariantes da árvore 'T' (ordem, cores e altura negra);
+    // preenche a quantidade de chaves e a profundidade real e retorna o número de violações
+    int llrb_auditar(LLRB *T, int *elementos, int *profundidade);
+
+    // Função para reconstruir a árvore 'T' em O(n) com profundidade ótima ou um nível acima dela
+    // (retorna false se faltar memória)
+    bool llrb_rebalancear(LLRB *T);
+
+    // Função para substituir o conteúdo da árvore pelas 'n' chaves em ordem estritamente crescente, em O(n)
+    // (carga em bloco); retorna false, sem alterar a árvore, se a ordem não for respeitada
+    bool llrb_carregar_ordenadas(LLRB *T, const int *chaves, int n);
+
+    // Funções para a menor e a maior chave em O(1) (guardadas na árvore); retornam false se ela estiver vazia
+    bool llrb_minimo(LLRB *T, int *chave);
+    bool llrb_maximo(LLRB *T, int *chave);
+
+    // Funções para os vizinhos de 'chave' em O(log n), que não precisa estar na árvore:
+    // sucessor (menor chave maior), antecessor (maior chave menor), piso (maior chave <= chave)
+    // e teto (menor chave >= chave). Retornam false se o vizinho não existir
+    bool llrb_sucessor(LLRB *T, int chave, int *resultado);
+    bool llrb_antecessor(LLRB *T, int chave, int *resultado);
+    bool llrb_piso(LLRB *T, int chave, int *resultado);
+    bool llrb_teto(LLRB *T, int chave, int *resultado);
+
+    // Função para criar um iterador em ordem sobre a árvore 'T'
+    // (a árvore não pode ser alterada enquanto o iterador existir)
+    LLRB_ITERADOR* llrb_iterador_criar(LLRB *T);
+
+    // Função para obter a próxima chave em ordem crescente; retorna false no fim
+    bool llrb_iterador_proximo(LLRB_ITERADOR *it, int *chave);
+
+    // Função para liberar o iterador
+    void llrb_iterador_apagar(LLRB_ITERADOR **it);
 
 #endif
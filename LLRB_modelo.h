@@ -0,0 +1,1094 @@
+// Modelo (template) da árvore rubro-negra esquerdista, instanciado por macros para
+// cada tipo de chave. Cada instância tem seu próprio layout de nó e sua comparação
+// expandida em linha, sem ponteiros genéricos nem chamadas indiretas nas comparações.
+//
+// Parâmetros (definidos antes de incluir este arquivo, que os apaga no final):
+//   LLRB_CHAVE                tipo da chave (ex.: int, int64_t, uma struct pequena)
+//   LLRB_PREFIXO              prefixo das funções e da struct da árvore (ex.: llrb -> llrb_inserir)
+//   LLRB_TIPO                 nome do tipo da árvore (ex.: LLRB)
+//   LLRB_ITERADOR_TIPO        nome do tipo do iterador (ex.: LLRB_ITERADOR)
+//   LLRB_COMPARAR(a, b)       opcional: negativo, zero ou positivo; padrão usa < e >
+//   LLRB_IMPRIMIR_CHAVE(c)    imprime uma chave seguida de espaço
+//   LLRB_MODELO_SEM_DECLARACOES  não gera os tipos e protótipos (já declarados em outro cabeçalho)
+//   LLRB_MODELO_IMPLEMENTAR      gera as definições das funções (em um único .c por instância)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "Alocador.h"
+
+#if !defined(LLRB_CHAVE) || !defined(LLRB_PREFIXO) || !defined(LLRB_TIPO) || !defined(LLRB_ITERADOR_TIPO)
+#error "Defina LLRB_CHAVE, LLRB_PREFIXO, LLRB_TIPO e LLRB_ITERADOR_TIPO antes de incluir LLRB_modelo.h"
+#endif
+
+#ifndef LLRB_COMPARAR
+#define LLRB_COMPARAR(a, b) (((a) > (b)) - ((a) < (b)))
+#endif
+
+#define LLRB_CONCATENAR_(a, b) a##_##b
+#define LLRB_CONCATENAR(a, b) LLRB_CONCATENAR_(a, b)
+#define LLRB_F(nome) LLRB_CONCATENAR(LLRB_PREFIXO, nome) // Nome da função nesta instância
+#define LLRB_MENOR(a, b) (LLRB_COMPARAR(a, b) < 0)
+#define LLRB_IGUAL(a, b) (LLRB_COMPARAR(a, b) == 0)
+
+#ifndef LLRB_MODELO_SEM_DECLARACOES
+
+// Tipos da árvore e do iterador em ordem crescente
+typedef struct LLRB_PREFIXO LLRB_TIPO;
+typedef struct LLRB_F(iterador) LLRB_ITERADOR_TIPO;
+
+// Função para criar uma nova árvore LLRB vazia
+LLRB_TIPO* LLRB_F(criar)(void);
+
+// Função para criar uma árvore LLRB vazia cujos nós e cabeçalho vêm de 'mem' (que ela
+// retém); clones e resultados de operações herdam o alocador de quem lhes dá os nós
+LLRB_TIPO* LLRB_F(criar_com_alocador)(ALOCADOR *mem);
+
+// Função que retorna o alocador usado pela árvore
+ALOCADOR* LLRB_F(alocador)(LLRB_TIPO *T);
+
+// Função para inserir uma chave na árvore LLRB 'T' (false se ela já existir)
+bool LLRB_F(inserir)(LLRB_TIPO *T, LLRB_CHAVE chave);
+
+// Função para verificar se uma chave existe na árvore LLRB 'T'
+bool LLRB_F(pertence)(LLRB_TIPO *T, LLRB_CHAVE chave);
+
+// Função para remover uma chave da árvore LLRB 'T' (false se ela não existir)
+bool LLRB_F(remover)(LLRB_TIPO *T, LLRB_CHAVE chave);
+
+// Função para apagar a árvore inteira e liberar a memória
+void LLRB_F(apagar)(LLRB_TIPO **T);
+
+// Função para clonar a árvore em O(1); os nós são compartilhados e copiados sob demanda
+LLRB_TIPO* LLRB_F(clonar)(LLRB_TIPO *T);
+
+// Função para calcular a união de 'T1' e 'T2' (compartilha com 'T1' as subárvores que não mudaram)
+LLRB_TIPO* LLRB_F(uniao)(LLRB_TIPO *T1, LLRB_TIPO *T2);
+
+// Função para calcular a interseção de 'T1' e 'T2' (compartilha com 'T1' as subárvores que não mudaram)
+LLRB_TIPO* LLRB_F(interseccao)(LLRB_TIPO *T1, LLRB_TIPO *T2);
+
+// Funções para a união e a interseção dentro de A em O(n + m), sem criar outra árvore; os nós
+// que saem são liberados de uma vez. As versões "_consumindo" reaproveitam os nós de B em vez
+// de alocar novos, se os alocadores forem compatíveis (veja alocador_compativel), e apagam B
+// (*B vira NULL; B deve ser diferente de A). Retornam false se faltar memória, sem alterar
+// o conteúdo de A
+bool LLRB_F(uniao_em)(LLRB_TIPO *A, LLRB_TIPO *B);
+bool LLRB_F(interseccao_em)(LLRB_TIPO *A, LLRB_TIPO *B);
+bool LLRB_F(uniao_em_consumindo)(LLRB_TIPO *A, LLRB_TIPO **B);
+bool LLRB_F(interseccao_em_consumindo)(LLRB_TIPO *A, LLRB_TIPO **B);
+
+// Função para imprimir os elementos da árvore em ordem
+void LLRB_F(imprimir)(LLRB_TIPO *T);
+
+// Função para verificar as invariantes da árvore 'T' (ordem das chaves, raiz preta, arestas
+// vermelhas só à esquerda e nunca duas seguidas, mesma altura negra em todos os caminhos);
+// preenche a quantidade de chaves e a profundidade real e retorna o número de violações
+int LLRB_F(auditar)(LLRB_TIPO *T, int *elementos, int *profundidade);
+
+// Função para reconstruir a árvore 'T' em O(n) com o máximo de níveis pretos completos
+// (profundidade ótima ou um nível acima dela), remontando os próprios nós sem alocar; só os
+// nós que ela divide com clones são copiados antes. Retorna false (sem alterar as chaves da
+// árvore) se faltar memória para essas cópias
+bool LLRB_F(rebalancear)(LLRB_TIPO *T);
+
+// Função para substituir o conteúdo da árvore 'T' pelas 'n' chaves de 'chaves', que devem estar
+// em ordem estritamente crescente, montando a árvore em O(n) como rebalancear (carga em bloco).
+// Retorna false (sem alterar a árvore) se a ordem não for respeitada ou faltar memória
+bool LLRB_F(carregar_ordenadas)(LLRB_TIPO *T, const LLRB_CHAVE *chaves, int n);
+
+// Funções para a menor e a maior chave em O(1) (guardadas na árvore); retornam false se ela estiver vazia
+bool LLRB_F(minimo)(LLRB_TIPO *T, LLRB_CHAVE *chave);
+bool LLRB_F(maximo)(LLRB_TIPO *T, LLRB_CHAVE *chave);
+
+// Funções para os vizinhos de 'chave' em O(log n), que não precisa estar na árvore: menor chave > chave
+// (sucessor), maior chave < chave (antecessor), maior chave <= chave (piso) e menor
+// chave >= chave (teto). Preenchem '*resultado' e retornam false se ele não existir
+bool LLRB_F(sucessor)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado);
+bool LLRB_F(antecessor)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado);
+bool LLRB_F(piso)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado);
+bool LLRB_F(teto)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado);
+
+// Função para criar um iterador em ordem sobre a árvore 'T'
+// (a árvore não pode ser alterada enquanto o iterador existir)
+LLRB_ITERADOR_TIPO* LLRB_F(iterador_criar)(LLRB_TIPO *T);
+
+// Função para obter a próxima chave em ordem crescente; retorna false no fim
+bool LLRB_F(iterador_proximo)(LLRB_ITERADOR_TIPO *it, LLRB_CHAVE *chave);
+
+// Função para liberar o iterador
+void LLRB_F(iterador_apagar)(LLRB_ITERADOR_TIPO **it);
+
+#endif // LLRB_MODELO_SEM_DECLARACOES
+
+#ifdef LLRB_MODELO_IMPLEMENTAR
+
+#ifndef LLRB_IMPRIMIR_CHAVE
+#error "Defina LLRB_IMPRIMIR_CHAVE para implementar uma instância de LLRB_modelo.h"
+#endif
+
+#define LLRB_NO struct LLRB_F(no)
+
+//Definição da estrutura da árvore Rubro negra(LLRB);
+struct LLRB_PREFIXO{
+    LLRB_NO* raiz;
+    LLRB_CHAVE minimo; //menor e maior chave (válidas se a raiz não for NULL); guardam valores e não
+    LLRB_CHAVE maximo; //nós, pois os nós das pontas mudam quando um caminho compartilhado é copiado
+    ALOCADOR* mem; //origem dos nós e do cabeçalho, compartilhada com os clones
+};
+
+//Definição da estrutura do nó da árvore 
+struct LLRB_F(no){
+    LLRB_CHAVE chave; //valor armazenado no nó
+    LLRB_NO* fesq; //ponteiro para filho esquerdo
+    LLRB_NO* fdir; //ponteiro para filho direito
+    int cor; // 1 para vermelha, 0 para preta 
+    int ref; // quantidade de referências (pais ou raízes) que compartilham o nó
+};
+
+// Criação de uma nova árvore rubro-negra com nós alocados por 'mem'
+LLRB_TIPO* LLRB_F(criar_com_alocador)(ALOCADOR *mem){
+    if(mem == NULL){
+        return(NULL);
+    }
+    LLRB_TIPO *T = (LLRB_TIPO*)alocador_alocar(mem, sizeof(LLRB_TIPO));
+    if(T != NULL){
+        T->raiz = NULL;
+        T->mem = alocador_reter(mem);
+        return(T);
+    }
+    return(NULL);
+}
+
+// Criação de uma nova árvore rubro-negra, com malloc e free
+LLRB_TIPO* LLRB_F(criar)(void){
+    ALOCADOR *mem = alocador_criar(NULL);
+    LLRB_TIPO *T = LLRB_F(criar_com_alocador)(mem);
+    alocador_soltar(&mem); // a árvore ficou com a única referência
+    return(T);
+}
+
+// Função que retorna o alocador usado pela árvore
+ALOCADOR* LLRB_F(alocador)(LLRB_TIPO *T){
+    return T ? T->mem : NULL;
+}
+// Função recursiva para apagar todos os nós da árvore
+static void LLRB_F(apagar_no)(ALOCADOR *mem, LLRB_NO *raiz) {
+    if (raiz == NULL) return;
+
+    // Nó compartilhado com outra árvore: apenas solta esta referência
+    if (--raiz->ref > 0) return;
+
+    // Apagar as subárvores esquerda e direita
+    LLRB_F(apagar_no)(mem, raiz->fesq);
+    LLRB_F(apagar_no)(mem, raiz->fdir);
+
+    // Desalocar o nó atual
+    alocador_liberar(mem, raiz, sizeof(LLRB_NO));
+    raiz = NULL;
+}
+
+
+// Função para apagar a árvore inteira
+void LLRB_F(apagar)(LLRB_TIPO **T) {
+    if (T == NULL || *T == NULL) return;
+
+    // Apagar a árvore recursivamente a partir da raiz
+    ALOCADOR *mem = (*T)->mem;
+    LLRB_F(apagar_no)(mem, (*T)->raiz);
+
+    // Desalocar a estrutura da árvore
+    alocador_liberar(mem, *T, sizeof(LLRB_TIPO));
+    alocador_soltar(&mem);
+    *T = NULL;
+}
+// Função para criar um novo nó da árvore
+static LLRB_NO* LLRB_F(criar_no)(ALOCADOR *mem, LLRB_CHAVE chave){
+    LLRB_NO* No = (LLRB_NO*)alocador_alocar(mem, sizeof(LLRB_NO));
+    if(No != NULL){
+        No->chave = chave;
+        No->fesq = NULL;
+        No->fdir = NULL;
+        No->cor = 1;
+        No->ref = 1;
+        return(No);
+    }
+    return(NULL);
+}
+
+// Retorna uma versão do nó que pode ser alterada sem afetar outras árvores.
+// Se o nó for compartilhado, é copiado e a cópia passa a compartilhar os filhos;
+// o resultado deve ser guardado no mesmo ponteiro de onde o nó foi lido. Retorna NULL se
+// faltar memória para a cópia (o nó não muda); por isso quem altera uma árvore compartilhada
+// reserva antes os nós que pode precisar copiar (veja LLRB_F(reservar))
+static LLRB_NO* LLRB_F(exclusivo)(ALOCADOR *mem, LLRB_NO *no){
+    if(no == NULL || no->ref == 1){
+        return no;
+    }
+    LLRB_NO* copia = LLRB_F(criar_no)(mem, no->chave);
+    if(copia == NULL){
+        return NULL;
+    }
+    copia->fesq = no->fesq;
+    copia->fdir = no->fdir;
+    copia->cor = no->cor;
+    if(copia->fesq) copia->fesq->ref++; // os filhos ganham mais um pai
+    if(copia->fdir) copia->fdir->ref++;
+    no->ref--; // a referência de quem chamou passa para a cópia
+    return copia;
+}
+
+// Garante memória para copiar até 'por_nivel' nós compartilhados em cada nível da árvore
+// durante uma alteração, que assim não falha pela metade. A altura é limitada pela altura
+// negra (contada pela ponta esquerda): no máximo o dobro, mais uma raiz vermelha. Uma árvore
+// que não divide o alocador com nenhuma outra não tem nós compartilhados e não reserva nada
+static bool LLRB_F(reservar)(LLRB_TIPO *T, int por_nivel){
+    if(!alocador_compartilhado(T->mem)){
+        return true;
+    }
+    int altura_negra = 0;
+    for(LLRB_NO *no = T->raiz; no != NULL; no = no->fesq){
+        altura_negra += !no->cor;
+    }
+    return alocador_reservar(T->mem, por_nivel * (2 * altura_negra + 3), sizeof(LLRB_NO));
+}
+
+// Copia todos os nós compartilhados da subárvore, para que ela possa ser desmontada sem
+// alocar. Se faltar memória retorna false; os nós já copiados são iguais aos originais,
+// então a árvore continua a mesma
+static bool LLRB_F(tornar_exclusiva)(ALOCADOR *mem, LLRB_NO **raiz){
+    if(*raiz == NULL){
+        return true;
+    }
+    LLRB_NO *no = LLRB_F(exclusivo)(mem, *raiz);
+    if(no == NULL){
+        return false;
+    }
+    *raiz = no;
+    return LLRB_F(tornar_exclusiva)(mem, &no->fesq) && LLRB_F(tornar_exclusiva)(mem, &no->fdir);
+}
+
+// Verifica se um nó é vermelho(arresta)
+static int LLRB_F(vermelha)(LLRB_NO *raiz){
+    if(raiz == NULL){
+        return 0; // Nó nulo é considerado preto(arresta)
+    }
+    return (raiz->cor == 1);
+}
+// Função de rotação à esquerda
+static LLRB_NO* LLRB_F(rodar_esquerda)(ALOCADOR *mem, LLRB_NO* raiz){
+    LLRB_NO* b;
+    raiz = LLRB_F(exclusivo)(mem, raiz);
+    raiz->fdir = LLRB_F(exclusivo)(mem, raiz->fdir);
+    b = raiz->fdir;
+    raiz->fdir = b->fesq;
+    b->fesq = raiz;
+
+    b->cor = raiz->cor;
+    raiz->cor = 1;
+    return b;
+}
+// Função de rotação à direita
+static LLRB_NO* LLRB_F(rodar_direita)(ALOCADOR *mem, LLRB_NO* raiz){
+    LLRB_NO* b;
+    raiz = LLRB_F(exclusivo)(mem, raiz);
+    raiz->fesq = LLRB_F(exclusivo)(mem, raiz->fesq);
+    b = raiz->fesq;
+    raiz->fesq = b->fdir;
+    b->fdir = raiz;
+
+    b->cor = raiz->cor;
+    raiz->cor = 1;
+    return b;
+}
+// Inverte a cor de um nó e seus filhos
+static LLRB_NO* LLRB_F(inverter_cor)(ALOCADOR *mem, LLRB_NO *raiz){
+    raiz->cor = !raiz->cor;
+    if(raiz->fesq){
+        raiz->fesq = LLRB_F(exclusivo)(mem, raiz->fesq);
+        raiz->fesq->cor = !raiz->fesq->cor;
+    }
+    if(raiz->fdir){
+        raiz->fdir = LLRB_F(exclusivo)(mem, raiz->fdir);
+        raiz->fdir->cor = !raiz->fdir->cor;
+    }
+    return raiz;
+}
+// Função para inserir um nó na árvore recursivamente
+static LLRB_NO* LLRB_F(inserir_no)(ALOCADOR *mem, LLRB_NO* raiz,LLRB_NO* novo_no){
+    if(raiz == NULL){
+        raiz = novo_no;// Caso base: árvore vazia, insere o novo nó
+        return raiz;
+    }
+    raiz = LLRB_F(exclusivo)(mem, raiz);// copia o nó se ele for compartilhado com outra árvore
+    if(LLRB_MENOR(novo_no->chave, raiz->chave)){
+        raiz->fesq = LLRB_F(inserir_no)(mem, raiz->fesq, novo_no); //inseri a esquerda
+    }
+    if(LLRB_MENOR(raiz->chave, novo_no->chave)){
+        raiz->fdir = LLRB_F(inserir_no)(mem, raiz->fdir, novo_no);//inseri a direita
+    }
+
+    //ajustando as cores e balanceamento
+    if(LLRB_F(vermelha)(raiz->fdir) && !LLRB_F(vermelha)(raiz->fesq)){
+        raiz = LLRB_F(rodar_esquerda)(mem, raiz);// Caso de rotação à esquerda
+    }
+    if(LLRB_F(vermelha)(raiz->fesq) && LLRB_F(vermelha)(raiz->fesq->fesq)){
+        raiz = LLRB_F(rodar_direita)(mem, raiz);// Caso de rotação à direita
+    }
+    if(LLRB_F(vermelha)(raiz->fesq) && LLRB_F(vermelha)(raiz->fdir)){
+        LLRB_F(inverter_cor)(mem, raiz);// Inverte as cores dos nós
+    }
+    return raiz;
+}
+
+//Função auxiliar que recalcula a menor e a maior chave descendo pelas pontas da árvore
+static void LLRB_F(atualizar_extremos)(LLRB_TIPO *T) {
+    LLRB_NO *no = T->raiz;
+    if (no == NULL) return;
+    while (no->fesq != NULL) no = no->fesq;
+    T->minimo = no->chave;
+    no = T->raiz;
+    while (no->fdir != NULL) no = no->fdir;
+    T->maximo = no->chave;
+}
+
+// Função para inserir um nó na árvore rubro-negra
+bool LLRB_F(inserir)(LLRB_TIPO *T, LLRB_CHAVE chave){
+    if(T == NULL){
+        return(false);// Se a árvore for NULL, não é possível inserir
+    }
+    if(LLRB_F(pertence)(T, chave)){
+        return(false);// Chave repetida: nenhuma alocação e nenhuma alteração na árvore
+    }
+    // cópias possíveis por nível: o nó do caminho e o irmão (troca de cores ou rotação)
+    if(!LLRB_F(reservar)(T, 3)){
+        return false;
+    }
+    LLRB_NO* novo_no = LLRB_F(criar_no)(T->mem, chave);//criando novo no
+    if(novo_no != NULL){
+        if(T->raiz == NULL || LLRB_MENOR(chave, T->minimo)) T->minimo = chave;// a nova chave pode
+        if(T->raiz == NULL || LLRB_MENOR(T->maximo, chave)) T->maximo = chave;// ser uma das pontas
+        T->raiz = LLRB_F(inserir_no)(T->mem, T->raiz, novo_no);// Insere o nó na árvore
+        T->raiz->cor = 0;// Garante que a raiz seja preta
+        return(true);
+    }
+    return false;// Retorna false se a criação do nó falhar
+   
+}
+// Função para verificar se um valor está presente na árvore
+bool LLRB_F(pertence)(LLRB_TIPO *T, LLRB_CHAVE chave) {
+    if (T == NULL || T->raiz == NULL) return false;  // Check if T or T->raiz is NULL
+
+    LLRB_NO *noAtual = T->raiz;
+    while (noAtual != NULL) {
+        if (LLRB_MENOR(chave, noAtual->chave)) {
+            noAtual = noAtual->fesq;  // Left child
+        } else if (LLRB_MENOR(noAtual->chave, chave)) {
+            noAtual = noAtual->fdir;  // Right child
+        } else {
+            return true;  // Found the element
+        }
+    }
+    return false;  // Element not found
+}
+
+//Esta função é responsável pela propagação de aresta vermelha na subárvore esquerda
+static LLRB_NO* LLRB_F(mover_aresta_esquerda)(ALOCADOR *mem, LLRB_NO* raiz){
+    raiz = LLRB_F(exclusivo)(mem, raiz);
+    LLRB_F(inverter_cor)(mem, raiz);
+    if (LLRB_F(vermelha)(raiz->fdir->fesq)) {
+        raiz->fdir = LLRB_F(rodar_direita)(mem, raiz->fdir);
+        raiz = LLRB_F(rodar_esquerda)(mem, raiz);
+        LLRB_F(inverter_cor)(mem, raiz);
+    }
+    return raiz;
+}
+//Esta função é responsável pela propagação de aresta vermelha na subárvore direita
+static LLRB_NO* LLRB_F(mover_aresta_direita)(ALOCADOR *mem, LLRB_NO* raiz) {
+    raiz = LLRB_F(exclusivo)(mem, raiz);
+    LLRB_F(inverter_cor)(mem, raiz);
+    if (LLRB_F(vermelha)(raiz->fesq->fesq)) {
+        raiz = LLRB_F(rodar_direita)(mem, raiz);
+        LLRB_F(inverter_cor)(mem, raiz);
+    }
+    return raiz;
+}
+//Esta função remove o nó com o valor mínimo da árvore rubro-negra.
+static LLRB_NO* LLRB_F(remover_minimo)(ALOCADOR *mem, LLRB_NO* raiz) {
+    if (raiz->fesq == NULL) {
+        LLRB_F(apagar_no)(mem, raiz);
+        return NULL;
+    }
+    raiz = LLRB_F(exclusivo)(mem, raiz);
+
+    if (!LLRB_F(vermelha)(raiz->fesq) && !LLRB_F(vermelha)(raiz->fesq->fesq)) {
+        raiz = LLRB_F(mover_aresta_esquerda)(mem, raiz);
+    }
+
+    raiz->fesq = LLRB_F(remover_minimo)(mem, raiz->fesq);
+
+    // Ajustar após remoção
+    if (LLRB_F(vermelha)(raiz->fdir)) {
+        raiz = LLRB_F(rodar_esquerda)(mem, raiz);
+    }
+    if (LLRB_F(vermelha)(raiz->fesq) && LLRB_F(vermelha)(raiz->fesq->fesq)) {
+        raiz = LLRB_F(rodar_direita)(mem, raiz);
+    }
+    if (LLRB_F(vermelha)(raiz->fesq) && LLRB_F(vermelha)(raiz->fdir)) {
+        LLRB_F(inverter_cor)(mem, raiz);
+    }
+
+    return raiz;
+}
+
+//Esta função busca o nó com o valor mínimo na árvore rubro-negra
+static LLRB_NO* LLRB_F(buscar_minimo)(LLRB_NO* raiz){
+    if (raiz == NULL) return NULL;
+    while (raiz->fesq != NULL) {
+        raiz = raiz->fesq;
+    }
+    return raiz;
+}
+
+//Função auxiliar para remoção do nó na árvore
+static LLRB_NO* LLRB_F(remover_no)(ALOCADOR *mem, LLRB_NO *raiz, LLRB_CHAVE chave) {
+    if (raiz == NULL) {
+        return NULL; // Chave não encontrada
+    }
+    raiz = LLRB_F(exclusivo)(mem, raiz); // copia o nó se ele for compartilhado com outra árvore
+
+    if (LLRB_MENOR(chave, raiz->chave)) {
+        // Remover na subárvore esquerda
+        if (!LLRB_F(vermelha)(raiz->fesq) && !LLRB_F(vermelha)(raiz->fesq->fesq)) {
+            raiz = LLRB_F(mover_aresta_esquerda)(mem, raiz);
+        }
+        raiz->fesq = LLRB_F(remover_no)(mem, raiz->fesq, chave);
+    } else {
+        // Caso especial: rodar para a direita se nó esquerdo for vermelho
+        if (LLRB_F(vermelha)(raiz->fesq)) {
+            raiz = LLRB_F(rodar_direita)(mem, raiz);
+        }
+
+        if (LLRB_IGUAL(chave, raiz->chave) && raiz->fdir == NULL) {
+            // Caso base: remover nó folha
+            LLRB_F(apagar_no)(mem, raiz);
+            return NULL;
+        }
+
+        // Ajustar subárvore direita para remoção
+        if (!LLRB_F(vermelha)(raiz->fdir) && !LLRB_F(vermelha)(raiz->fdir->fesq)) {
+            raiz = LLRB_F(mover_aresta_direita)(mem, raiz);
+        }
+
+        if (LLRB_IGUAL(chave, raiz->chave)) {
+            // Substituir pelo sucessor
+            LLRB_NO* min = LLRB_F(buscar_minimo)(raiz->fdir);
+            raiz->chave = min->chave;
+            raiz->fdir = LLRB_F(remover_minimo)(mem, raiz->fdir);
+        } else {
+            raiz->fdir = LLRB_F(remover_no)(mem, raiz->fdir, chave);
+        }
+    }
+
+    // Chamando diretamente as funções de balanceamento
+    if (LLRB_F(vermelha)(raiz->fdir)) {
+        raiz = LLRB_F(rodar_esquerda)(mem, raiz);
+    }
+    if (LLRB_F(vermelha)(raiz->fesq) && LLRB_F(vermelha)(raiz->fesq->fesq)) {
+        raiz = LLRB_F(rodar_direita)(mem, raiz);
+    }
+    if (LLRB_F(vermelha)(raiz->fesq) && LLRB_F(vermelha)(raiz->fdir)) {
+        LLRB_F(inverter_cor)(mem, raiz);
+    }
+
+    return raiz;
+}
+
+//Função principal para remover um nó na árvore
+bool LLRB_F(remover)(LLRB_TIPO *T, LLRB_CHAVE chave) {
+    if (T == NULL || T->raiz == NULL) {
+        return false; // Árvore vazia, não há o que remover
+    }
+
+    // A descida da remoção rotaciona e troca cores no caminho; uma busca só de leitura
+    // evita reformatar a árvore quando a chave não existe
+    if (!LLRB_F(pertence)(T, chave)) {
+        return false;
+    }
+    // A descida e a subida mexem no nó do caminho, nos dois filhos e em um neto por nível
+    if (!LLRB_F(reservar)(T, 6)) {
+        return false;
+    }
+
+    // Realizar a remoção e ajustar a raiz para ser preta
+    T->raiz = LLRB_F(remover_no)(T->mem, T->raiz, chave);
+    
+    if (T->raiz != NULL) {
+        T->raiz->cor = 0; // Preto
+    }
+    if (LLRB_IGUAL(chave, T->minimo) || LLRB_IGUAL(chave, T->maximo)) {
+        LLRB_F(atualizar_extremos)(T); // saiu uma das pontas: desce até a nova em O(log n)
+    }
+    return true;
+}
+
+// Função para clonar uma árvore rubro-negra em O(1): o clone compartilha todos os nós
+LLRB_TIPO* LLRB_F(clonar)(LLRB_TIPO *T) {
+    if (T == NULL) return LLRB_F(criar)();
+    LLRB_TIPO *C = LLRB_F(criar_com_alocador)(T->mem); // os nós compartilhados vêm do mesmo alocador
+    if (C == NULL) return NULL;
+
+    C->raiz = T->raiz; // alterações futuras em qualquer uma das árvores copiam só o caminho
+    C->minimo = T->minimo;
+    C->maximo = T->maximo;
+    if (C->raiz != NULL) {
+        C->raiz->ref++;
+    }
+    return C;
+}
+
+// Função auxiliar para inserir na árvore 'C' os elementos de uma subárvore
+static void LLRB_F(inserir_todos)(LLRB_NO *raiz, LLRB_TIPO *C) {
+    if (raiz == NULL) return;
+
+    LLRB_F(inserir)(C, raiz->chave);
+    LLRB_F(inserir_todos)(raiz->fesq, C);
+    LLRB_F(inserir_todos)(raiz->fdir, C);
+}
+
+// Função para calcular a união de duas árvores rubro-negras
+LLRB_TIPO* LLRB_F(uniao)(LLRB_TIPO *A, LLRB_TIPO *B) {
+    if (!A || !B) return NULL;
+
+    // Parte de A: as subárvores não alteradas pelos elementos de B continuam compartilhadas
+    LLRB_TIPO *C = LLRB_F(clonar)(A);
+    if (C != NULL) {
+        LLRB_F(inserir_todos)(B->raiz, C);
+    }
+    return C;
+}
+
+// Função auxiliar que retira de 'C' os elementos da subárvore que não estão em B
+static void LLRB_F(percorrer_e_remover)(LLRB_NO* raizA, LLRB_TIPO *B, LLRB_TIPO *C) {
+    if (raizA == NULL) return;
+
+    if (!LLRB_F(pertence)(B, raizA->chave)) {
+        LLRB_F(remover)(C, raizA->chave);
+    }
+    LLRB_F(percorrer_e_remover)(raizA->fesq, B, C);
+    LLRB_F(percorrer_e_remover)(raizA->fdir, B, C);
+}
+
+// Função para calcular a interseção de duas árvores rubro-negras
+LLRB_TIPO* LLRB_F(interseccao)(LLRB_TIPO *A, LLRB_TIPO *B) {
+    if (!A || !B) return NULL;
+
+    // Parte de A e remove o que não está em B; o que não mudou continua compartilhado
+    LLRB_TIPO *C = LLRB_F(clonar)(A);
+    if (C != NULL) {
+        LLRB_F(percorrer_e_remover)(A->raiz, B, C);
+    }
+    return C;
+}
+
+//Função auxiliar para imprimir o nó
+static void LLRB_F(imprimir_no)(LLRB_NO *raiz) {
+    if (raiz == NULL) return;
+        
+    LLRB_F(imprimir_no)(raiz->fesq);
+    LLRB_IMPRIMIR_CHAVE(raiz->chave);
+    LLRB_F(imprimir_no)(raiz->fdir);    
+}
+//Função para imprimir os nós na árvore
+void LLRB_F(imprimir)(LLRB_TIPO *T){
+    if(T != NULL || T->raiz != NULL){
+        LLRB_F(imprimir_no)(T->raiz);
+    }
+    
+}
+
+//Função auxiliar que percorre a subárvore conferindo as invariantes; 'min' e 'max' (quando
+//não nulos) limitam as chaves permitidas. Retorna a altura negra da subárvore
+static int LLRB_F(auditar_no)(LLRB_NO *no, const LLRB_CHAVE *min, const LLRB_CHAVE *max, int nivel,
+                              int *elementos, int *profundidade, int *violacoes) {
+    if (no == NULL) {
+        if (nivel > *profundidade) *profundidade = nivel;
+        return 0;
+    }
+
+    (*elementos)++;
+    if ((min != NULL && !LLRB_MENOR(*min, no->chave)) || (max != NULL && !LLRB_MENOR(no->chave, *max))) {
+        (*violacoes)++; // chave fora de ordem
+    }
+    if (LLRB_F(vermelha)(no->fdir)) {
+        (*violacoes)++; // aresta vermelha à direita
+    }
+    if (LLRB_F(vermelha)(no) && LLRB_F(vermelha)(no->fesq)) {
+        (*violacoes)++; // duas arestas vermelhas seguidas
+    }
+    int esq = LLRB_F(auditar_no)(no->fesq, min, &no->chave, nivel + 1, elementos, profundidade, violacoes);
+    int dir = LLRB_F(auditar_no)(no->fdir, &no->chave, max, nivel + 1, elementos, profundidade, violacoes);
+    if (esq != dir) {
+        (*violacoes)++; // altura negra diferente entre as subárvores
+    }
+    return esq + !LLRB_F(vermelha)(no);
+}
+
+//Função para verificar as invariantes da árvore e medir sua profundidade
+int LLRB_F(auditar)(LLRB_TIPO *T, int *elementos, int *profundidade) {
+    int violacoes = 0;
+    *elementos = 0;
+    *profundidade = 0;
+    if (T != NULL) {
+        if (LLRB_F(vermelha)(T->raiz)) {
+            violacoes++; // a raiz deve ser preta
+        }
+        LLRB_F(auditar_no)(T->raiz, NULL, NULL, 0, elementos, profundidade, &violacoes);
+    }
+    return violacoes;
+}
+
+//Maior quantidade de chaves em uma árvore 2-3 completa de altura 'h' (3^h - 1)
+static long long LLRB_F(capacidade)(int h) {
+    long long c = 1;
+    while (h-- > 0) c *= 3;
+    return c - 1;
+}
+
+//Função auxiliar que constrói a LLRB de altura negra 'h' com as 'n' chaves ordenadas
+//(2^h - 1 <= n <= 3^h - 1). Cada nó da árvore 2-3 equivalente guarda uma chave (nó preto)
+//ou duas (nó preto com filho esquerdo vermelho) e as chaves restantes são repartidas
+//igualmente entre as subárvores. '*ok' vira false se faltar memória
+static LLRB_NO* LLRB_F(construir)(ALOCADOR *mem, const LLRB_CHAVE *chaves, int n, int h, bool *ok) {
+    if (h == 0 || !*ok) return NULL;
+
+    if (n - 1 <= 2 * LLRB_F(capacidade)(h - 1)) {
+        // Nó com uma chave
+        int esq = (n - 1) / 2;
+        LLRB_NO *no = LLRB_F(criar_no)(mem, chaves[esq]);
+        if (no == NULL) {
+            *ok = false;
+            return NULL;
+        }
+        no->cor = 0;
+        no->fesq = LLRB_F(construir)(mem, chaves, esq, h - 1, ok);
+        no->fdir = LLRB_F(construir)(mem, chaves + esq + 1, n - esq - 1, h - 1, ok);
+        return no;
+    }
+
+    // Nó com duas chaves: subárvores a < chaves[a] < b < chaves[a + 1 + b] < c
+    int a = (n - 2) / 3, b = (n - 2 - a) / 2, c = n - 2 - a - b;
+    LLRB_NO *no = LLRB_F(criar_no)(mem, chaves[a + 1 + b]);
+    LLRB_NO *vermelho = LLRB_F(criar_no)(mem, chaves[a]);
+    if (no == NULL || vermelho == NULL) {
+        alocador_liberar(mem, no, sizeof(LLRB_NO));
+        alocador_liberar(mem, vermelho, sizeof(LLRB_NO));
+        *ok = false;
+        return NULL;
+    }
+    no->cor = 0;
+    no->fesq = vermelho;
+    vermelho->fesq = LLRB_F(construir)(mem, chaves, a, h - 1, ok);
+    vermelho->fdir = LLRB_F(construir)(mem, chaves + a + 1, b, h - 1, ok);
+    no->fdir = LLRB_F(construir)(mem, chaves + a + 2 + b, c, h - 1, ok);
+    return no;
+}
+
+//Função auxiliar que transforma a árvore em uma "vinha": lista em ordem crescente encadeada
+//por 'fdir', feita por rotações à direita, sem pilha nem alocação (Day-Stout-Warren). Nenhum
+//nó pode ser compartilhado (veja LLRB_F(tornar_exclusiva))
+static LLRB_NO* LLRB_F(vinha)(LLRB_NO *raiz) {
+    LLRB_NO cabeca;
+    LLRB_NO *cauda = &cabeca;
+    cabeca.fdir = raiz;
+    while (cauda->fdir != NULL) {
+        LLRB_NO *resto = cauda->fdir;
+        if (resto->fesq == NULL) {
+            cauda = resto; // já está na lista; avança
+        } else {
+            LLRB_NO *esq = resto->fesq;
+            resto->fesq = esq->fdir; // rotação à direita sobre 'resto'
+            esq->fdir = resto;
+            cauda->fdir = esq;
+        }
+    }
+    return cabeca.fdir;
+}
+
+//Função auxiliar que monta, como em construir, a LLRB de altura negra 'h' com os 'n'
+//primeiros nós da vinha '*lista', reaproveitando os próprios nós, e avança '*lista'
+static LLRB_NO* LLRB_F(construir_vinha)(LLRB_NO **lista, int n, int h) {
+    if (h == 0) return NULL;
+
+    if (n - 1 <= 2 * LLRB_F(capacidade)(h - 1)) {
+        // Nó com uma chave
+        int esq = (n - 1) / 2;
+        LLRB_NO *subarvore = LLRB_F(construir_vinha)(lista, esq, h - 1);
+        LLRB_NO *no = *lista;
+        *lista = no->fdir;
+        no->cor = 0;
+        no->fesq = subarvore;
+        no->fdir = LLRB_F(construir_vinha)(lista, n - esq - 1, h - 1);
+        return no;
+    }
+
+    // Nó com duas chaves: o vermelho vem antes do preto na vinha
+    int a = (n - 2) / 3, b = (n - 2 - a) / 2, c = n - 2 - a - b;
+    LLRB_NO *subarvore = LLRB_F(construir_vinha)(lista, a, h - 1);
+    LLRB_NO *vermelho = *lista;
+    *lista = vermelho->fdir;
+    vermelho->cor = 1;
+    vermelho->fesq = subarvore;
+    vermelho->fdir = LLRB_F(construir_vinha)(lista, b, h - 1);
+    LLRB_NO *no = *lista;
+    *lista = no->fdir;
+    no->cor = 0;
+    no->fesq = vermelho;
+    no->fdir = LLRB_F(construir_vinha)(lista, c, h - 1);
+    return no;
+}
+
+//Função para reconstruir a árvore com o máximo de níveis pretos completos em O(n),
+//reaproveitando os nós
+bool LLRB_F(rebalancear)(LLRB_TIPO *T) {
+    if (T == NULL || T->raiz == NULL) return T != NULL;
+
+    // a árvore é desmontada no lugar: só os nós que ela divide com clones são copiados antes
+    if (alocador_compartilhado(T->mem) && !LLRB_F(tornar_exclusiva)(T->mem, &T->raiz)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+
+    LLRB_NO *lista = LLRB_F(vinha)(T->raiz);
+    int n = 0;
+    for (LLRB_NO *no = lista; no != NULL; no = no->fdir) n++;
+
+    // Maior altura negra possível: o máximo de níveis pretos completos
+    int h = 0;
+    while ((2LL << h) - 1 <= n) h++;
+
+    T->raiz = LLRB_F(construir_vinha)(&lista, n, h);
+    return true;
+}
+
+//Função auxiliar que obtém a próxima chave de B: da vinha '*vinha_b' (o nó sai da lista e vai
+//para '*no') ou, se ela não existir, do iterador 'it' (e '*no' fica NULL)
+static bool LLRB_F(proximo_b)(LLRB_NO **vinha_b, LLRB_ITERADOR_TIPO *it, LLRB_CHAVE *chave, LLRB_NO **no) {
+    if (it != NULL) {
+        *no = NULL;
+        return LLRB_F(iterador_proximo)(it, chave);
+    }
+    if (*vinha_b == NULL) return false;
+    *no = *vinha_b;
+    *vinha_b = (*no)->fdir;
+    *chave = (*no)->chave;
+    return true;
+}
+
+//Função auxiliar para a união ou interseção dentro de A: a árvore de A vira uma vinha, que é
+//intercalada em ordem com as chaves de B (da vinha 'vinha_b', cujos nós são reaproveitados, ou
+//do iterador 'it_b'); os nós que sobram são liberados na mesma passada e o resultado é
+//remontado em O(n + m)
+static bool LLRB_F(combinar_em)(LLRB_TIPO *A, LLRB_NO *vinha_b, LLRB_ITERADOR_TIPO *it_b, bool uniao) {
+    ALOCADOR *mem = A->mem;
+    LLRB_NO *a = LLRB_F(vinha)(A->raiz);
+    LLRB_NO cabeca, *cauda = &cabeca, *no = NULL;
+    LLRB_CHAVE chave = {0}; //Só é lida quando tem_b (iniciada para o otimizador não acusar uso sem valor)
+    bool ok = true;
+    int n = 0;
+
+    bool tem_b = LLRB_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+    while (a != NULL || tem_b) {
+        if (a == NULL || (tem_b && LLRB_MENOR(chave, a->chave))) {
+            // chave só de B: entra na união (com o nó de B ou um novo, já reservado) e some da interseção
+            if (uniao) {
+                if (no == NULL && (no = LLRB_F(criar_no)(mem, chave)) == NULL) {
+                    ok = false;
+                } else {
+                    cauda = cauda->fdir = no;
+                    n++;
+                }
+            } else {
+                alocador_liberar(mem, no, sizeof(LLRB_NO));
+            }
+            tem_b = LLRB_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+        } else {
+            LLRB_NO *proximo = a->fdir;
+            if (tem_b && LLRB_IGUAL(chave, a->chave)) {
+                alocador_liberar(mem, no, sizeof(LLRB_NO)); // chave dos dois lados: fica o nó de A
+                tem_b = LLRB_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+                cauda = cauda->fdir = a;
+                n++;
+            } else if (uniao) {
+                cauda = cauda->fdir = a; // chave só de A
+                n++;
+            } else {
+                alocador_liberar(mem, a, sizeof(LLRB_NO));
+            }
+            a = proximo;
+        }
+    }
+    cauda->fdir = NULL;
+
+    // Maior altura negra possível, como em rebalancear
+    int h = 0;
+    while ((2LL << h) - 1 <= n) h++;
+
+    LLRB_NO *lista = cabeca.fdir;
+    A->raiz = LLRB_F(construir_vinha)(&lista, n, h);
+    LLRB_F(atualizar_extremos)(A);
+    if (!ok) fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+    return ok;
+}
+
+//Função auxiliar que conta as chaves de B que faltam em A, percorrendo as duas em ordem: são
+//os nós que a união dentro de A precisa criar. Retorna -1 se faltar memória para os iteradores
+static int LLRB_F(contar_novas)(LLRB_TIPO *A, LLRB_TIPO *B) {
+    LLRB_ITERADOR_TIPO *it_a = LLRB_F(iterador_criar)(A), *it_b = LLRB_F(iterador_criar)(B);
+    int novas = -1;
+    if (it_a != NULL && it_b != NULL) {
+        LLRB_CHAVE a = {0}, b = {0};
+        bool tem_a = LLRB_F(iterador_proximo)(it_a, &a), tem_b = LLRB_F(iterador_proximo)(it_b, &b);
+        novas = 0;
+        while (tem_b) {
+            if (!tem_a || LLRB_MENOR(b, a)) {
+                novas++;
+                tem_b = LLRB_F(iterador_proximo)(it_b, &b);
+            } else {
+                if (LLRB_IGUAL(a, b)) tem_b = LLRB_F(iterador_proximo)(it_b, &b);
+                tem_a = LLRB_F(iterador_proximo)(it_a, &a);
+            }
+        }
+    }
+    LLRB_F(iterador_apagar)(&it_a);
+    LLRB_F(iterador_apagar)(&it_b);
+    return novas;
+}
+
+//Função auxiliar para combinar com B sem alterá-la: as chaves de B são lidas por um iterador
+static bool LLRB_F(combinar_com)(LLRB_TIPO *A, LLRB_TIPO *B, bool uniao) {
+    if (A == NULL) return false;
+    if (A == B) return true; // A ∪ A = A ∩ A = A
+
+    // A é desmontada no lugar: antes, os nós que ela divide com clones são copiados
+    if (alocador_compartilhado(A->mem) && !LLRB_F(tornar_exclusiva)(A->mem, &A->raiz)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    // a união cria um nó para cada chave que só B tem: eles são reservados antes da
+    // intercalação, e a falta de memória não deixa a união pela metade
+    int novas = uniao ? LLRB_F(contar_novas)(A, B) : 0;
+    if (novas < 0 || (novas > 0 && !alocador_reservar(A->mem, novas, sizeof(LLRB_NO)))) return false;
+    LLRB_ITERADOR_TIPO *it = LLRB_F(iterador_criar)(B);
+    if (it == NULL) return false;
+    bool ok = LLRB_F(combinar_em)(A, NULL, it, uniao);
+    LLRB_F(iterador_apagar)(&it);
+    return ok;
+}
+
+//Função auxiliar para combinar consumindo B: a árvore de B vira uma vinha cujos nós são
+//movidos para A ou liberados, e a estrutura de B é apagada
+static bool LLRB_F(combinar_consumindo)(LLRB_TIPO *A, LLRB_TIPO **B, bool uniao) {
+    if (A == NULL || B == NULL || *B == NULL || *B == A) return false;
+    // os nós de B só mudam de dono se o alocador de A puder liberá-los, e os compartilhados
+    // só podem ser movidos depois de copiados; se não der para copiá-los, B é lida e apagada
+    ALOCADOR *mem_b = (*B)->mem;
+    if (!alocador_compativel(mem_b, A->mem) ||
+        (alocador_compartilhado(mem_b) && !LLRB_F(tornar_exclusiva)(mem_b, &(*B)->raiz)) ||
+        (alocador_compartilhado(A->mem) && !LLRB_F(tornar_exclusiva)(A->mem, &A->raiz))) {
+        bool ok = LLRB_F(combinar_com)(A, *B, uniao);
+        LLRB_F(apagar)(B);
+        return ok;
+    }
+
+    LLRB_NO *vinha_b = LLRB_F(vinha)((*B)->raiz);
+    (*B)->raiz = NULL;
+    if (mem_b != A->mem) {
+        // cada conjunto tem o seu alocador: os nós de B passam para a contabilidade de A
+        size_t n = 0;
+        for (LLRB_NO *no = vinha_b; no != NULL; no = no->fdir) n++;
+        alocador_transferir(mem_b, A->mem, n * sizeof(LLRB_NO));
+    }
+    LLRB_F(apagar)(B);
+    return LLRB_F(combinar_em)(A, vinha_b, NULL, uniao);
+}
+
+//Função para guardar em A a união de A e B (B não é alterada)
+bool LLRB_F(uniao_em)(LLRB_TIPO *A, LLRB_TIPO *B) {
+    return LLRB_F(combinar_com)(A, B, true);
+}
+
+//Função para guardar em A a interseção de A e B (B não é alterada)
+bool LLRB_F(interseccao_em)(LLRB_TIPO *A, LLRB_TIPO *B) {
+    return LLRB_F(combinar_com)(A, B, false);
+}
+
+//Função para guardar em A a união de A e B reaproveitando os nós de B, que é apagada
+bool LLRB_F(uniao_em_consumindo)(LLRB_TIPO *A, LLRB_TIPO **B) {
+    return LLRB_F(combinar_consumindo)(A, B, true);
+}
+
+//Função para guardar em A a interseção de A e B liberando os nós de B, que é apagada
+bool LLRB_F(interseccao_em_consumindo)(LLRB_TIPO *A, LLRB_TIPO **B) {
+    return LLRB_F(combinar_consumindo)(A, B, false);
+}
+
+//Função para carregar a árvore em bloco a partir de chaves já ordenadas
+bool LLRB_F(carregar_ordenadas)(LLRB_TIPO *T, const LLRB_CHAVE *chaves, int n) {
+    if (T == NULL || n < 0) return false;
+    for (int i = 1; i < n; i++) {
+        if (!LLRB_MENOR(chaves[i - 1], chaves[i])) return false; // fora de ordem ou repetida
+    }
+
+    // Maior altura negra possível, como em rebalancear
+    int h = 0;
+    while ((2LL << h) - 1 <= n) h++;
+
+    bool ok = true;
+    LLRB_NO *raiz = LLRB_F(construir)(T->mem, chaves, n, h, &ok);
+    if (!ok) {
+        LLRB_F(apagar_no)(T->mem, raiz);
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    LLRB_F(apagar_no)(T->mem, T->raiz);
+    T->raiz = raiz;
+    if (n > 0) {
+        T->minimo = chaves[0];
+        T->maximo = chaves[n - 1];
+    }
+    return true;
+}
+
+//! Retorna a menor chave da árvore rubro-negra em O(1)
+bool LLRB_F(minimo)(LLRB_TIPO *T, LLRB_CHAVE *chave) {
+    if (T == NULL || T->raiz == NULL) return false;
+    *chave = T->minimo;
+    return true;
+}
+
+//! Retorna a maior chave da árvore rubro-negra em O(1)
+bool LLRB_F(maximo)(LLRB_TIPO *T, LLRB_CHAVE *chave) {
+    if (T == NULL || T->raiz == NULL) return false;
+    *chave = T->maximo;
+    return true;
+}
+
+// Desce uma vez da raiz procurando a chave mais próxima de 'chave' acima dela ('acima')
+// ou abaixo; se 'inclusivo', a própria chave também serve
+static bool LLRB_F(vizinho)(LLRB_TIPO *T, LLRB_CHAVE chave, bool acima, bool inclusivo, LLRB_CHAVE *resultado) {
+    bool achou = false;
+    LLRB_NO *no = T ? T->raiz : NULL;
+    while (no != NULL) {
+        int c = LLRB_COMPARAR(no->chave, chave);
+        if (c == 0 && inclusivo) {
+            *resultado = no->chave;
+            return true;
+        }
+        if (acima ? c > 0 : c < 0) {
+            *resultado = no->chave; // Candidata; pode haver outra mais próxima no lado de dentro
+            achou = true;
+            no = acima ? no->fesq : no->fdir;
+        } else {
+            no = acima ? no->fdir : no->fesq;
+        }
+    }
+    return achou;
+}
+
+//! Menor chave maior que 'chave'
+bool LLRB_F(sucessor)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado) {
+    return LLRB_F(vizinho)(T, chave, true, false, resultado);
+}
+
+//! Maior chave menor que 'chave'
+bool LLRB_F(antecessor)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado) {
+    return LLRB_F(vizinho)(T, chave, false, false, resultado);
+}
+
+//! Maior chave menor ou igual a 'chave'
+bool LLRB_F(piso)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado) {
+    return LLRB_F(vizinho)(T, chave, false, true, resultado);
+}
+
+//! Menor chave maior ou igual a 'chave'
+bool LLRB_F(teto)(LLRB_TIPO *T, LLRB_CHAVE chave, LLRB_CHAVE *resultado) {
+    return LLRB_F(vizinho)(T, chave, true, true, resultado);
+}
+
+//Definição do iterador: pilha explícita com os ancestrais ainda não visitados
+struct LLRB_F(iterador){
+    LLRB_NO** pilha; //nós pendentes; o topo é o próximo a ser visitado
+    int topo; //quantidade de nós na pilha
+    int capacidade; //capacidade alocada da pilha
+};
+
+//Empilha o nó e todos os seus descendentes à esquerda
+static bool LLRB_F(iterador_descer)(LLRB_ITERADOR_TIPO *it, LLRB_NO *no){
+    while(no != NULL){
+        if(it->topo == it->capacidade){
+            int capacidade = it->capacidade ? 2 * it->capacidade : 64;
+            LLRB_NO** pilha = (LLRB_NO**)realloc(it->pilha, capacidade * sizeof(LLRB_NO*));
+            if(pilha == NULL){
+                return false;
+            }
+            it->pilha = pilha;
+            it->capacidade = capacidade;
+        }
+        it->pilha[it->topo++] = no;
+        no = no->fesq;
+    }
+    return true;
+}
+
+//Função para criar um iterador em ordem sobre a árvore
+LLRB_ITERADOR_TIPO* LLRB_F(iterador_criar)(LLRB_TIPO *T){
+    LLRB_ITERADOR_TIPO *it = (LLRB_ITERADOR_TIPO*)malloc(sizeof(LLRB_ITERADOR_TIPO));
+    if(it == NULL){
+        return NULL;
+    }
+    it->pilha = NULL;
+    it->topo = it->capacidade = 0;
+    if(T != NULL && !LLRB_F(iterador_descer)(it, T->raiz)){
+        LLRB_F(iterador_apagar)(&it);
+        return NULL;
+    }
+    return it;
+}
+
+//Função para obter a próxima chave em ordem crescente
+bool LLRB_F(iterador_proximo)(LLRB_ITERADOR_TIPO *it, LLRB_CHAVE *chave){
+    if(it == NULL || it->topo == 0){
+        return false;
+    }
+    LLRB_NO* no = it->pilha[--it->topo];
+    *chave = no->chave;
+    return LLRB_F(iterador_descer)(it, no->fdir);
+}
+
+//Função para liberar o iterador
+void LLRB_F(iterador_apagar)(LLRB_ITERADOR_TIPO **it){
+    if(it == NULL || *it == NULL){
+        return;
+    }
+    free((*it)->pilha);
+    free(*it);
+    *it = NULL;
+}
+
+#undef LLRB_NO
+#endif // LLRB_MODELO_IMPLEMENTAR
+
+#undef LLRB_CHAVE
+#undef LLRB_PREFIXO
+#undef LLRB_TIPO
+#undef LLRB_ITERADOR_TIPO
+#undef LLRB_COMPARAR
+#undef LLRB_IMPRIMIR_CHAVE
+#undef LLRB_MODELO_SEM_DECLARACOES
+#undef LLRB_MODELO_IMPLEMENTAR
+#undef LLRB_CONCATENAR_
+#undef LLRB_CONCATENAR
+#undef LLRB_F
+#undef LLRB_MENOR
+#undef LLRB_IGUAL
@@ -0,0 +1,289 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Lote.h"
+#include "Registro.h"
+#include "Externo.h"
+#include "Expressao.h"
+
+#define LOTE_MAX_LINHA 4096 // Tamanho máximo de uma linha de comando
+#define LOTE_MAX_NOME 256   // Tamanho máximo de nomes de conjuntos e arquivos
+
+// Converte o nome do tipo ("avl", "llrb", "splay" ou "0", "1", "2") para a constante do conjunto
+static int lote_tipo(const char *nome) {
+    if (strcmp(nome, "avl") == 0 || strcmp(nome, "0") == 0) return AVL_TYPE;
+    if (strcmp(nome, "llrb") == 0 || strcmp(nome, "1") == 0) return LLRB_TYPE;
+    if (strcmp(nome, "splay") == 0 || strcmp(nome, "2") == 0) return SPLAY_TYPE;
+    return -1;
+}
+
+// Insere no conjunto todos os inteiros de um arquivo
+static bool lote_carregar(SET *s, const char *arquivo) {
+    FILE *f = fopen(arquivo, "r");
+    if (f == NULL) return false;
+
+    int elemento;
+    while (fscanf(f, "%d", &elemento) == 1) {
+        set_inserir(s, elemento);
+    }
+    bool ok = feof(f); // Parou no fim do arquivo, e não em um valor inválido
+    fclose(f);
+    return ok;
+}
+
+// Grava os elementos do conjunto em ordem crescente, um por linha
+static bool lote_salvar(SET *s, const char *arquivo) {
+    FILE *f = fopen(arquivo, "w");
+    if (f == NULL) return false;
+
+    SET_ITERADOR *it = set_iterador_criar(s);
+    int elemento;
+    while (set_iterador_proximo(it, &elemento)) {
+        fprintf(f, "%d\n", elemento);
+    }
+    set_iterador_apagar(&it);
+    return fclose(f) == 0;
+}
+
+// Analisador da expressão do comando "expressao": nomes de conjuntos combinados com
+// + (união), * (interseção), - (diferença) e parênteses, sem espaços; * tem precedência
+// sobre + e -, e operadores de mesma precedência associam à esquerda
+typedef struct {
+    REGISTRO *r;
+    const char *p;    // Próximo caractere a ler
+    const char *erro; // Motivo da falha, se houver
+} LOTE_EXPR;
+
+static SET_EXPR *lote_expr_soma(LOTE_EXPR *l);
+
+// Fator: um nome de conjunto ou uma expressão entre parênteses
+static SET_EXPR *lote_expr_fator(LOTE_EXPR *l) {
+    if (*l->p == '(') {
+        l->p++;
+        SET_EXPR *e = lote_expr_soma(l);
+        if (e != NULL && *l->p != ')') {
+            set_expr_apagar(&e);
+            l->erro = "expressao invalida";
+        }
+        if (e != NULL) l->p++;
+        return e;
+    }
+
+    char nome[LOTE_MAX_NOME];
+    size_t n = 0;
+    while ((isalnum((unsigned char)*l->p) || *l->p == '_') && n < sizeof(nome) - 1) {
+        nome[n++] = *l->p++;
+    }
+    nome[n] = '\0';
+    if (n == 0) {
+        l->erro = "expressao invalida";
+        return NULL;
+    }
+    SET *s = registro_buscar(l->r, nome);
+    if (s == NULL) {
+        l->erro = "conjunto inexistente";
+        return NULL;
+    }
+    return set_expr_conjunto(s);
+}
+
+// Termo: fatores ligados por *
+static SET_EXPR *lote_expr_termo(LOTE_EXPR *l) {
+    SET_EXPR *e = lote_expr_fator(l);
+    while (e != NULL && *l->p == '*') {
+        l->p++;
+        e = set_expr_interseccao(e, lote_expr_fator(l));
+    }
+    return e;
+}
+
+// Soma: termos ligados por + e -
+static SET_EXPR *lote_expr_soma(LOTE_EXPR *l) {
+    SET_EXPR *e = lote_expr_termo(l);
+    while (e != NULL && (*l->p == '+' || *l->p == '-')) {
+        char op = *l->p++;
+        SET_EXPR *b = lote_expr_termo(l);
+        e = (op == '+') ? set_expr_uniao(e, b) : set_expr_diferenca(e, b);
+    }
+    return e;
+}
+
+// Monta a expressão do texto; em caso de falha devolve NULL e o motivo em 'erro'
+static SET_EXPR *lote_expr(REGISTRO *r, const char *texto, const char **erro) {
+    LOTE_EXPR l = {r, texto, NULL};
+    SET_EXPR *e = lote_expr_soma(&l);
+    if (e != NULL && *l.p != '\0') {
+        set_expr_apagar(&e);
+        l.erro = "expressao invalida";
+    }
+    *erro = (l.erro != NULL) ? l.erro : "falta de memoria";
+    return e;
+}
+
+// Executa um comando já separado em palavras; retorna a mensagem de erro ou NULL
+static const char *lote_comando(REGISTRO *r, FILE *saida, size_t *memoria, char *cmd, char *arg1, char *arg2,
+                                char *arg3, char *arg4, int n) {
+    int elemento;
+    char extra;
+
+    if (strcmp(cmd, "memoria") == 0) {
+        if (n != 2 || sscanf(arg1, "%d%c", &elemento, &extra) != 1 || elemento <= 0) return "uso: memoria <MB>";
+        *memoria = (size_t)elemento << 20;
+        return NULL;
+    }
+    if (n == 5 && strcmp(cmd, "externo") != 0) return "argumentos demais";
+
+    if (strcmp(cmd, "criar") == 0) {
+        if ((n != 3 && n != 4) || (n == 4 && strcmp(arg3, "filtro") != 0)) {
+            return "uso: criar <nome> <avl|llrb|splay> [filtro]";
+        }
+        int tipo = lote_tipo(arg2);
+        if (tipo < 0) return "tipo invalido";
+        SET *s = n == 4 ? set_criar_com_filtro((unsigned char)tipo) : set_criar((unsigned char)tipo);
+        if (s == NULL) return "falha ao criar o conjunto";
+        if (!registro_definir(r, arg1, s)) {
+            set_apagar(&s);
+            return "falha ao registrar o conjunto";
+        }
+        return NULL;
+    }
+
+    if (strcmp(cmd, "uniao") == 0 || strcmp(cmd, "interseccao") == 0) {
+        if (n != 4) return "uso: uniao|interseccao <destino> <A> <B>";
+        SET *A = registro_buscar(r, arg2), *B = registro_buscar(r, arg3);
+        if (A == NULL || B == NULL) return "conjunto inexistente";
+        SET *resultado = (cmd[0] == 'u') ? set_uniao(A, B) : set_interseccao(A, B);
+        if (resultado == NULL) return "falha ao calcular o conjunto (tipos diferentes ou falta de memoria)";
+        if (!registro_definir(r, arg1, resultado)) {
+            set_apagar(&resultado);
+            return "falha ao registrar o conjunto";
+        }
+        return NULL;
+    }
+
+    if (strcmp(cmd, "expressao") == 0) {
+        if (n != 4) return "uso: expressao <destino> <avl|llrb|splay> <expressao>";
+        int tipo = lote_tipo(arg2);
+        if (tipo < 0) return "tipo invalido";
+        const char *erro;
+        SET_EXPR *e = lote_expr(r, arg3, &erro);
+        if (e == NULL) return erro;
+        // Materializa antes de registrar: o destino pode ser um dos operandos
+        SET *resultado = set_expr_materializar(e, (unsigned char)tipo);
+        set_expr_apagar(&e);
+        if (resultado == NULL) return "falha ao calcular a expressao";
+        if (!registro_definir(r, arg1, resultado)) {
+            set_apagar(&resultado);
+            return "falha ao registrar o conjunto";
+        }
+        return NULL;
+    }
+
+    if (strcmp(cmd, "apagar") == 0) {
+        if (n != 2) return "uso: apagar <nome>";
+        return registro_remover(r, arg1) ? NULL : "conjunto inexistente";
+    }
+
+    // Os demais comandos atuam sobre um conjunto existente
+    if (n < 2) return "comando incompleto";
+    SET *s = registro_buscar(r, arg1);
+    if (s == NULL) return "conjunto inexistente";
+
+    if (strcmp(cmd, "imprimir") == 0) {
+        if (n != 2) return "uso: imprimir <nome>";
+        SET_ITERADOR *it = set_iterador_criar(s);
+        while (set_iterador_proximo(it, &elemento)) {
+            fprintf(saida, "%d ", elemento);
+        }
+        set_iterador_apagar(&it);
+        fprintf(saida, "\n");
+        return NULL;
+    }
+    if (strcmp(cmd, "auditar") == 0) {
+        if (n != 2) return "uso: auditar <nome>";
+        set_auditar(s, saida);
+        return NULL;
+    }
+    if (strcmp(cmd, "estatisticas") == 0) {
+        if (n != 2) return "uso: estatisticas <nome>";
+        SET_ESTATISTICAS e;
+        set_estatisticas(s, &e);
+        fprintf(saida, "Memoria: %zu bytes", e.memoria);
+        if (e.embutido) fprintf(saida, "; embutido, %d elementos", e.elementos);
+        if (e.filtro) {
+            fprintf(saida, "; filtro: %zu bytes, %lld consultas, %lld descartadas, %lld falsos positivos (%.2f%%)",
+                    e.filtro_bytes, e.consultas, e.descartadas, e.falsos_positivos, 100.0 * e.taxa_falsos_positivos);
+        }
+        fprintf(saida, "\n");
+        return NULL;
+    }
+    if (strcmp(cmd, "rebalancear") == 0) {
+        if (n != 2) return "uso: rebalancear <nome>";
+        return set_rebalancear(s) ? NULL : "falha ao rebalancear o conjunto";
+    }
+    if (strcmp(cmd, "comprimir") == 0) {
+        if (n != 2) return "uso: comprimir <nome>";
+        return set_comprimir(s) ? NULL : "falha ao comprimir o conjunto";
+    }
+    if (strcmp(cmd, "descomprimir") == 0) {
+        if (n != 3) return "uso: descomprimir <nome> <avl|llrb|splay>";
+        int tipo = lote_tipo(arg2);
+        if (tipo < 0) return "tipo invalido";
+        return set_descomprimir(s, (unsigned char)tipo) ? NULL : "falha ao descomprimir o conjunto";
+    }
+    if (strcmp(cmd, "externo") == 0) {
+        if (n != 5) return "uso: externo <nome> <uniao|interseccao|diferenca> <arqA> <arqB>";
+        int operacao = externo_operacao(arg2);
+        if (operacao < 0) return "operacao invalida";
+        return externo_carregar(arg3, arg4, operacao, *memoria, s) ? NULL : "falha na operacao externa";
+    }
+    if (strcmp(cmd, "carregar") == 0) {
+        if (n != 3) return "uso: carregar <nome> <arquivo>";
+        return lote_carregar(s, arg2) ? NULL : "falha ao ler o arquivo";
+    }
+    if (strcmp(cmd, "salvar") == 0) {
+        if (n != 3) return "uso: salvar <nome> <arquivo>";
+        return lote_salvar(s, arg2) ? NULL : "falha ao gravar o arquivo";
+    }
+
+    // Comandos com um elemento inteiro
+    if (n != 3 || sscanf(arg2, "%d%c", &elemento, &extra) != 1) return "elemento invalido";
+
+    if (strcmp(cmd, "inserir") == 0) {
+        set_inserir(s, elemento);
+    } else if (strcmp(cmd, "remover") == 0) {
+        set_remover(s, elemento);
+    } else if (strcmp(cmd, "pertence") == 0) {
+        fprintf(saida, set_pertence(s, elemento) ? "Pertence\n" : "Nao pertence\n");
+    } else {
+        return "comando desconhecido";
+    }
+    return NULL;
+}
+
+// Executa os comandos lidos de 'entrada'
+int lote_executar(FILE *entrada, FILE *saida) {
+    REGISTRO *r = registro_criar();
+    if (r == NULL) return 1;
+
+    char linha[LOTE_MAX_LINHA];
+    char cmd[LOTE_MAX_NOME], arg1[LOTE_MAX_NOME], arg2[LOTE_MAX_NOME], arg3[LOTE_MAX_NOME], arg4[LOTE_MAX_NOME], extra[2];
+    int erros = 0, numero = 0;
+    size_t memoria = EXTERNO_MEMORIA_PADRAO;
+
+    while (fgets(linha, sizeof(linha), entrada) != NULL) {
+        numero++;
+        int n = sscanf(linha, "%255s %255s %255s %255s %255s %1s", cmd, arg1, arg2, arg3, arg4, extra);
+        if (n <= 0 || cmd[0] == '#') continue; // Linha vazia ou comentário
+
+        const char *erro = (n == 6) ? "argumentos demais" : lote_comando(r, saida, &memoria, cmd, arg1, arg2, arg3, arg4, n);
+        if (erro != NULL) {
+            fprintf(stderr, "Erro (linha %d): %s\n", numero, erro);
+            erros++;
+        }
+    }
+
+    registro_apagar(&r);
+    return erros;
+}
@@ -0,0 +1,40 @@
+#ifndef _LOTE_H
+#define _LOTE_H
+
+#include <stdio.h>
+
+// Modo em lote: executa uma sequência de comandos sobre conjuntos nomeados que
+// permanecem vivos durante toda a execução, evitando recarregar os conjuntos a cada
+// operação. Um comando por linha; linhas vazias e iniciadas por '#' são ignoradas:
+//
+//   criar <nome> <avl|llrb|splay> [filtro]  cria (ou recria vazio) um conjunto, com filtro
+//                                      de pertinência se pedido
+//   carregar <nome> <arquivo>          insere no conjunto os inteiros do arquivo
+//   inserir <nome> <elemento>          insere um elemento
+//   remover <nome> <elemento>          remove um elemento
+//   pertence <nome> <elemento>         imprime "Pertence" ou "Nao pertence"
+//   uniao <destino> <A> <B>            destino = A ∪ B
+//   interseccao <destino> <A> <B>      destino = A ∩ B
+//   expressao <destino> <avl|llrb|splay> <expr>  destino = expr, com nomes de conjuntos,
+//                                      + (união), * (interseção), - (diferença) e parênteses,
+//                                      sem espaços, como (A+B)*C-D; avaliada em fluxo
+//                                      (ver Expressao.h) e carregada em bloco no destino
+//   imprimir <nome>                    imprime os elementos em ordem crescente
+//   salvar <nome> <arquivo>            grava os elementos, um por linha, em ordem crescente
+//   auditar <nome>                     confere as invariantes da árvore e mostra sua profundidade
+//                                      (no comprimido, os bytes por elemento)
+//   estatisticas <nome>                memória usada, se o conjunto está embutido e, com filtro,
+//                                      a taxa de falsos positivos
+//   rebalancear <nome>                 reconstrói a árvore com balanceamento perfeito em O(n)
+//   comprimir <nome>                   troca a árvore por blocos comprimidos somente leitura
+//   descomprimir <nome> <avl|llrb|splay>  volta o conjunto comprimido para uma árvore
+//   memoria <MB>                       limite de memória dos comandos externos (padrão 64)
+//   externo <nome> <op> <arqA> <arqB>  carrega no conjunto (já criado) o resultado de
+//                                      arqA op arqB, com op uniao, interseccao ou diferenca,
+//                                      calculado em memória externa (ver Externo.h)
+//   apagar <nome>                      libera o conjunto
+//
+// Retorna a quantidade de comandos que falharam (mensagens vão para stderr)
+int lote_executar(FILE *entrada, FILE *saida);
+
+#endif
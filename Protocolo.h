@@ -0,0 +1,40 @@
+#ifndef _PROTOCOLO_CONJUNTOS_H
+#define _PROTOCOLO_CONJUNTOS_H
+
+// Protocolo binário do servidor de conjuntos (Servidor.c) sobre socket de domínio Unix.
+// Os inteiros usam a ordem de bytes da máquina, já que cliente e servidor rodam no mesmo host.
+// O cliente pode enviar várias requisições seguidas sem esperar as respostas (pipelining);
+// as respostas chegam na mesma ordem das requisições, agrupadas em poucas escritas.
+//
+// Requisição:
+//   u32 tamanho        bytes que seguem este campo
+//   u8  op             uma das operações abaixo
+//   u8  tipo           AVL_TYPE, LLRB_TYPE ou SPLAY_TYPE (apenas em PROTO_CRIAR)
+//   u8  n_nomes        quantidade de nomes que seguem
+//   u8  reservado      zero
+//   n_nomes x { u8 comprimento, bytes do nome (sem terminador) }
+//   i32 elementos...   o restante da requisição
+//
+// Resposta:
+//   u32 tamanho        bytes que seguem este campo
+//   u8  op             operação respondida
+//   u8  status         PROTO_OK ou PROTO_ERRO
+//   u16 reservado      zero
+//   dados...           conforme a operação
+
+#define PROTO_CRIAR 1        // nomes: conjunto             | resposta: vazia
+#define PROTO_APAGAR 2       // nomes: conjunto             | resposta: vazia
+#define PROTO_INSERIR 3      // nomes: conjunto; elementos  | resposta: u32 quantidade inserida
+#define PROTO_REMOVER 4      // nomes: conjunto; elementos  | resposta: u32 quantidade removida
+#define PROTO_PERTENCE 5     // nomes: conjunto; elementos  | resposta: u8 (0/1) por elemento
+#define PROTO_UNIAO 6        // nomes: destino, A, B        | resposta: vazia
+#define PROTO_INTERSECCAO 7  // nomes: destino, A, B        | resposta: vazia
+#define PROTO_ELEMENTOS 8    // nomes: conjunto             | resposta: i32 por elemento, em ordem
+
+#define PROTO_OK 0
+#define PROTO_ERRO 1
+
+#define PROTO_CABECALHO 8                  // Bytes do cabeçalho (incluindo o tamanho)
+#define PROTO_MAX_QUADRO (16u * 1024 * 1024) // Maior requisição aceita pelo servidor
+
+#endif
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Registro.h"
+
+#define REGISTRO_CAPACIDADE_INICIAL 64 // Quantidade inicial de listas da tabela
+
+// Entrada da tabela: um conjunto e seu nome
+typedef struct entrada ENTRADA;
+struct entrada {
+    char *nome;       // Nome do conjunto (cópia própria)
+    SET *conjunto;    // Conjunto guardado
+    ENTRADA *prox;    // Próxima entrada da mesma lista
+};
+
+struct registro {
+    ENTRADA **listas;   // Tabela de dispersão com encadeamento
+    size_t capacidade;  // Quantidade de listas
+    size_t quantidade;  // Quantidade de conjuntos guardados
+};
+
+// Função de dispersão FNV-1a sobre o nome
+static size_t registro_hash(const char *nome) {
+    size_t h = 2166136261u;
+    for (; *nome; nome++) {
+        h ^= (unsigned char)*nome;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Cria um registro vazio
+REGISTRO *registro_criar(void) {
+    REGISTRO *r = (REGISTRO *)malloc(sizeof(REGISTRO));
+    if (r == NULL) {
+        fprintf(stderr, "Erro ao alocar memória para o registro.\n");
+        return NULL;
+    }
+    r->capacidade = REGISTRO_CAPACIDADE_INICIAL;
+    r->quantidade = 0;
+    r->listas = (ENTRADA **)calloc(r->capacidade, sizeof(ENTRADA *));
+    if (r->listas == NULL) {
+        fprintf(stderr, "Erro ao alocar memória para o registro.\n");
+        free(r);
+        return NULL;
+    }
+    return r;
+}
+
+// Apaga o registro e todos os conjuntos
+void registro_apagar(REGISTRO **r) {
+    if (r == NULL || *r == NULL) return;
+
+    for (size_t i = 0; i < (*r)->capacidade; i++) {
+        ENTRADA *e = (*r)->listas[i];
+        while (e != NULL) {
+            ENTRADA *prox = e->prox;
+            set_apagar(&e->conjunto);
+            free(e->nome);
+            free(e);
+            e = prox;
+        }
+    }
+    free((*r)->listas);
+    free(*r);
+    *r = NULL;
+}
+
+// Função auxiliar que localiza o ponteiro que aponta para a entrada com o nome dado
+static ENTRADA **registro_localizar(REGISTRO *r, const char *nome) {
+    ENTRADA **p = &r->listas[registro_hash(nome) % r->capacidade];
+    while (*p != NULL && strcmp((*p)->nome, nome) != 0) {
+        p = &(*p)->prox;
+    }
+    return p;
+}
+
+// Função auxiliar que dobra a tabela quando ela fica cheia
+static void registro_crescer(REGISTRO *r) {
+    size_t capacidade = 2 * r->capacidade;
+    ENTRADA **listas = (ENTRADA **)calloc(capacidade, sizeof(ENTRADA *));
+    if (listas == NULL) return; // Continua com a tabela atual, apenas mais lenta
+
+    for (size_t i = 0; i < r->capacidade; i++) {
+        ENTRADA *e = r->listas[i];
+        while (e != NULL) {
+            ENTRADA *prox = e->prox;
+            size_t j = registro_hash(e->nome) % capacidade;
+            e->prox = listas[j];
+            listas[j] = e;
+            e = prox;
+        }
+    }
+    free(r->listas);
+    r->listas = listas;
+    r->capacidade = capacidade;
+}
+
+// Busca um conjunto pelo nome
+SET *registro_buscar(REGISTRO *r, const char *nome) {
+    if (r == NULL || nome == NULL) return NULL;
+
+    ENTRADA *e = *registro_localizar(r, nome);
+    return e ? e->conjunto : NULL;
+}
+
+// Guarda um conjunto com o nome dado, substituindo o anterior
+bool registro_definir(REGISTRO *r, const char *nome, SET *s) {
+    if (r == NULL || nome == NULL || s == NULL) return false;
+
+    ENTRADA **p = registro_localizar(r, nome);
+    if (*p != NULL) {
+        if ((*p)->conjunto != s) set_apagar(&(*p)->conjunto);
+        (*p)->conjunto = s;
+        return true;
+    }
+
+    ENTRADA *e = (ENTRADA *)malloc(sizeof(ENTRADA));
+    size_t tamanho = strlen(nome) + 1;
+    char *copia = (char *)malloc(tamanho);
+    if (e == NULL || copia == NULL) {
+        fprintf(stderr, "Erro ao alocar memória para o registro.\n");
+        free(e);
+        free(copia);
+        return false;
+    }
+    memcpy(copia, nome, tamanho);
+    e->nome = copia;
+    e->conjunto = s;
+    e->prox = NULL;
+    *p = e;
+
+    if (++r->quantidade > r->capacidade) registro_crescer(r);
+    return true;
+}
+
+// Apaga o conjunto com o nome dado
+bool registro_remover(REGISTRO *r, const char *nome) {
+    if (r == NULL || nome == NULL) return false;
+
+    ENTRADA **p = registro_localizar(r, nome);
+    if (*p == NULL) return false;
+
+    ENTRADA *e = *p;
+    *p = e->prox;
+    set_apagar(&e->conjunto);
+    free(e->nome);
+    free(e);
+    r->quantidade--;
+    return true;
+}
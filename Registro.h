@@ -0,0 +1,26 @@
+#ifndef _REGISTRO_CONJUNTOS_H
+#define _REGISTRO_CONJUNTOS_H
+
+#include <stdbool.h>
+#include "Conjunto.h"
+
+// Tabela de conjuntos identificados por nome, mantidos vivos entre várias operações.
+// O registro é dono dos conjuntos guardados nele.
+typedef struct registro REGISTRO;
+
+// Cria um registro vazio
+REGISTRO *registro_criar(void);
+
+// Apaga o registro e todos os conjuntos guardados nele
+void registro_apagar(REGISTRO **r);
+
+// Retorna o conjunto com o nome dado, ou NULL se não existir
+SET *registro_buscar(REGISTRO *r, const char *nome);
+
+// Guarda o conjunto com o nome dado; um conjunto anterior com o mesmo nome é apagado
+bool registro_definir(REGISTRO *r, const char *nome, SET *s);
+
+// Apaga o conjunto com o nome dado; retorna false se ele não existir
+bool registro_remover(REGISTRO *r, const char *nome);
+
+#endif
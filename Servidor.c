@@ -0,0 +1,363 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "Conjunto.h"
+#include "Registro.h"
+#include "Protocolo.h"
+
+#define MAX_EVENTOS 64      // Eventos tratados por chamada a epoll_wait
+#define TAMANHO_LEITURA 65536 // Bytes lidos por chamada a read
+#define SAIDA_MAXIMA (1 << 20) // Saída pendente a partir da qual a conexão deixa de ser lida
+
+// Buffer de bytes que cresce conforme a necessidade
+typedef struct {
+    unsigned char *dados;
+    size_t tamanho;
+    size_t capacidade;
+} BUFFER;
+
+// Estado de uma conexão de cliente
+typedef struct {
+    int fd;
+    BUFFER entrada;        // Bytes recebidos ainda não processados
+    BUFFER saida;          // Respostas acumuladas ainda não enviadas
+    size_t enviado;        // Quanto da saída já foi enviado
+    bool aguardando_saida; // Se EPOLLOUT está ativo para a conexão
+    bool fim_entrada;      // O cliente já fechou o lado de escrita
+} CONEXAO;
+
+static volatile sig_atomic_t encerrar = 0;
+
+static void tratar_sinal(int sinal) {
+    (void)sinal;
+    encerrar = 1;
+}
+
+// Garante espaço para mais 'extra' bytes no buffer
+static bool buffer_reservar(BUFFER *b, size_t extra) {
+    if (b->tamanho + extra <= b->capacidade) return true;
+
+    size_t capacidade = b->capacidade ? b->capacidade : 4096;
+    while (capacidade < b->tamanho + extra) capacidade *= 2;
+    unsigned char *dados = (unsigned char *)realloc(b->dados, capacidade);
+    if (dados == NULL) return false;
+    b->dados = dados;
+    b->capacidade = capacidade;
+    return true;
+}
+
+static bool buffer_anexar(BUFFER *b, const void *p, size_t n) {
+    if (!buffer_reservar(b, n)) return false;
+    memcpy(b->dados + b->tamanho, p, n);
+    b->tamanho += n;
+    return true;
+}
+
+// Escreve o cabeçalho de uma resposta e guarda em 'inicio' onde ele começa; o tamanho é
+// corrigido em resposta_fechar. Retorna false, sem alterar o buffer, se faltar memória
+static bool resposta_abrir(BUFFER *saida, uint8_t op, uint8_t status, size_t *inicio) {
+    *inicio = saida->tamanho;
+    unsigned char cabecalho[PROTO_CABECALHO] = {0};
+    cabecalho[4] = op;
+    cabecalho[5] = status;
+    return buffer_anexar(saida, cabecalho, sizeof(cabecalho));
+}
+
+static void resposta_fechar(BUFFER *saida, size_t inicio) {
+    uint32_t tamanho = (uint32_t)(saida->tamanho - inicio - sizeof(uint32_t));
+    memcpy(saida->dados + inicio, &tamanho, sizeof(tamanho));
+}
+
+// Anexa os elementos do conjunto em ordem crescente; retorna false se faltar memória
+static bool responder_elementos(BUFFER *saida, SET *s) {
+    SET_ITERADOR *it = set_iterador_criar(s);
+    bool ok = it != NULL;
+    int elemento;
+    while (ok && set_iterador_proximo(it, &elemento)) {
+        int32_t v = elemento;
+        ok = buffer_anexar(saida, &v, sizeof(v));
+    }
+    set_iterador_apagar(&it);
+    return ok;
+}
+
+// Executa uma requisição completa e anexa a resposta; retorna false se o quadro for inválido
+// ou se nem a resposta de erro couber na memória (em ambos os casos a conexão é encerrada)
+static bool processar_requisicao(REGISTRO *r, const unsigned char *q, uint32_t tamanho, BUFFER *saida) {
+    if (tamanho < PROTO_CABECALHO - sizeof(uint32_t)) return false;
+
+    uint8_t op = q[0], tipo = q[1], n_nomes = q[2];
+    const unsigned char *p = q + 4, *fim = q + tamanho;
+    char nomes[3][256];
+
+    if (n_nomes > 3) return false;
+    for (int i = 0; i < n_nomes; i++) {
+        if (p >= fim || p + 1 + p[0] > fim) return false;
+        memcpy(nomes[i], p + 1, p[0]);
+        nomes[i][p[0]] = '\0';
+        p += 1 + p[0];
+    }
+    if ((fim - p) % sizeof(int32_t) != 0) return false;
+    size_t n_elementos = (size_t)(fim - p) / sizeof(int32_t);
+
+    size_t inicio;
+    if (!resposta_abrir(saida, op, PROTO_OK, &inicio)) return false;
+    bool ok = true;
+    SET *s = n_nomes > 0 ? registro_buscar(r, nomes[0]) : NULL;
+
+    switch (op) {
+        case PROTO_CRIAR: {
+            // Só as árvores: um conjunto comprimido criado vazio não poderia receber elementos
+            SET *novo = n_nomes == 1 && tipo <= SPLAY_TYPE ? set_criar(tipo) : NULL;
+            ok = novo != NULL && registro_definir(r, nomes[0], novo);
+            if (!ok) set_apagar(&novo);
+            break;
+        }
+        case PROTO_APAGAR:
+            ok = n_nomes == 1 && registro_remover(r, nomes[0]);
+            break;
+
+        case PROTO_INSERIR:
+        case PROTO_REMOVER: {
+            ok = n_nomes == 1 && s != NULL;
+            uint32_t alterados = 0;
+            for (size_t i = 0; ok && i < n_elementos; i++) {
+                int32_t v;
+                memcpy(&v, p + i * sizeof(v), sizeof(v));
+                alterados += op == PROTO_INSERIR ? set_inserir(s, v) : set_remover(s, v);
+            }
+            ok = ok && buffer_anexar(saida, &alterados, sizeof(alterados));
+            break;
+        }
+        case PROTO_PERTENCE:
+            ok = n_nomes == 1 && s != NULL && buffer_reservar(saida, n_elementos);
+            for (size_t i = 0; ok && i < n_elementos; i++) {
+                int32_t v;
+                memcpy(&v, p + i * sizeof(v), sizeof(v));
+                saida->dados[saida->tamanho++] = set_pertence(s, v);
+            }
+            break;
+
+        case PROTO_UNIAO:
+        case PROTO_INTERSECCAO: {
+            SET *A = n_nomes == 3 ? registro_buscar(r, nomes[1]) : NULL;
+            SET *B = n_nomes == 3 ? registro_buscar(r, nomes[2]) : NULL;
+            SET *resultado = NULL;
+            if (A != NULL && B != NULL)
+                resultado = op == PROTO_UNIAO ? set_uniao(A, B) : set_interseccao(A, B);
+            ok = resultado != NULL && registro_definir(r, nomes[0], resultado);
+            if (!ok) set_apagar(&resultado);
+            break;
+        }
+        case PROTO_ELEMENTOS:
+            ok = n_nomes == 1 && s != NULL;
+            ok = ok && responder_elementos(saida, s);
+            break;
+
+        default:
+            ok = false;
+    }
+
+    if (!ok) { // Descarta dados parciais e responde apenas o erro
+        saida->tamanho = inicio;
+        if (!resposta_abrir(saida, op, PROTO_ERRO, &inicio)) return false;
+    }
+    resposta_fechar(saida, inicio);
+    return true;
+}
+
+static void conexao_fechar(int epoll_fd, CONEXAO *c) {
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    free(c->entrada.dados);
+    free(c->saida.dados);
+    free(c);
+}
+
+// Se o cliente acumulou respostas demais sem lê-las; até ele consumir a saída, a conexão não
+// é lida nem processada e as requisições seguintes esperam no socket
+static bool conexao_saida_cheia(CONEXAO *c) {
+    return c->saida.tamanho - c->enviado > SAIDA_MAXIMA;
+}
+
+// Se a entrada guarda uma requisição completa ainda não processada
+static bool conexao_requisicao_pendente(CONEXAO *c) {
+    uint32_t tamanho;
+    if (c->entrada.tamanho < sizeof(tamanho)) return false;
+    memcpy(&tamanho, c->entrada.dados, sizeof(tamanho));
+    return c->entrada.tamanho - sizeof(tamanho) >= tamanho;
+}
+
+// Envia o que for possível da saída; ativa EPOLLOUT se o socket encher, sem EPOLLIN
+// enquanto a saída estiver cheia
+static bool conexao_enviar(int epoll_fd, CONEXAO *c) {
+    while (c->enviado < c->saida.tamanho) {
+        ssize_t n = send(c->fd, c->saida.dados + c->enviado, c->saida.tamanho - c->enviado, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return false;
+
+            // Depois do fim da entrada, só interessa saber quando o socket esvaziar
+            bool ler = !c->fim_entrada && !conexao_saida_cheia(c);
+            struct epoll_event ev = {.events = ler ? EPOLLIN | EPOLLOUT : EPOLLOUT, .data.ptr = c};
+            epoll_ctl(epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+            c->aguardando_saida = true;
+            return true;
+        }
+        c->enviado += (size_t)n;
+    }
+
+    c->saida.tamanho = c->enviado = 0;
+    if (c->aguardando_saida) {
+        struct epoll_event ev = {.events = EPOLLIN, .data.ptr = c};
+        epoll_ctl(epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+        c->aguardando_saida = false;
+    }
+    return true;
+}
+
+// Processa em sequência as requisições completas enviadas em pipeline, parando se a saída encher
+static bool conexao_processar(REGISTRO *r, CONEXAO *c) {
+    size_t pos = 0;
+    while (!conexao_saida_cheia(c) && c->entrada.tamanho - pos >= sizeof(uint32_t)) {
+        uint32_t tamanho;
+        memcpy(&tamanho, c->entrada.dados + pos, sizeof(tamanho));
+        if (tamanho > PROTO_MAX_QUADRO) return false;
+        if (c->entrada.tamanho - pos - sizeof(uint32_t) < tamanho) break; // Quadro incompleto
+
+        if (!processar_requisicao(r, c->entrada.dados + pos + sizeof(uint32_t), tamanho, &c->saida))
+            return false;
+        pos += sizeof(uint32_t) + tamanho;
+    }
+    memmove(c->entrada.dados, c->entrada.dados + pos, c->entrada.tamanho - pos);
+    c->entrada.tamanho -= pos;
+    return true;
+}
+
+// Processa o que sobrou na entrada e lê e processa o que estiver disponível, enquanto a
+// saída não encher
+static bool conexao_ler(REGISTRO *r, CONEXAO *c) {
+    if (!conexao_processar(r, c)) return false;
+    while (!c->fim_entrada && !conexao_saida_cheia(c)) {
+        if (!buffer_reservar(&c->entrada, TAMANHO_LEITURA)) return false;
+        ssize_t n = read(c->fd, c->entrada.dados + c->entrada.tamanho, TAMANHO_LEITURA);
+        if (n == 0) { // Cliente terminou de enviar; responde o que já chegou
+            c->fim_entrada = true;
+            break;
+        }
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+        c->entrada.tamanho += (size_t)n;
+        if (!conexao_processar(r, c)) return false;
+    }
+    return true;
+}
+
+static int definir_nao_bloqueante(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    return flags < 0 ? -1 : fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+// Cria o socket de escuta no caminho dado
+static int abrir_escuta(const char *caminho) {
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    if (strlen(caminho) >= sizeof(endereco.sun_path)) {
+        fprintf(stderr, "Erro: caminho do socket muito longo.\n");
+        return -1;
+    }
+    strcpy(endereco.sun_path, caminho);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    unlink(caminho);
+    if (bind(fd, (struct sockaddr *)&endereco, sizeof(endereco)) < 0 || listen(fd, SOMAXCONN) < 0 ||
+        definir_nao_bloqueante(fd) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Aceita todas as conexões pendentes
+static void aceitar_conexoes(int epoll_fd, int escuta) {
+    for (;;) {
+        int fd = accept(escuta, NULL, NULL);
+        if (fd < 0) return; // EAGAIN: não há mais conexões pendentes
+
+        CONEXAO *c = (CONEXAO *)calloc(1, sizeof(CONEXAO));
+        struct epoll_event ev = {.events = EPOLLIN};
+        ev.data.ptr = c;
+        if (c == NULL || definir_nao_bloqueante(fd) < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            free(c);
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Uso: %s <caminho do socket>\n", argv[0]);
+        return 1;
+    }
+
+    struct sigaction acao;
+    memset(&acao, 0, sizeof(acao));
+    acao.sa_handler = tratar_sinal;
+    sigaction(SIGINT, &acao, NULL);
+    sigaction(SIGTERM, &acao, NULL);
+
+    REGISTRO *registro = registro_criar();
+    int escuta = abrir_escuta(argv[1]);
+    int epoll_fd = epoll_create1(0);
+    struct epoll_event ev = {.events = EPOLLIN, .data.ptr = NULL}; // NULL identifica o socket de escuta
+    if (registro == NULL || escuta < 0 || epoll_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, escuta, &ev) < 0) {
+        perror("Erro ao iniciar o servidor");
+        return 1;
+    }
+
+    struct epoll_event eventos[MAX_EVENTOS];
+    while (!encerrar) {
+        int n = epoll_wait(epoll_fd, eventos, MAX_EVENTOS, -1);
+        for (int i = 0; i < n; i++) {
+            CONEXAO *c = eventos[i].data.ptr;
+            if (c == NULL) {
+                aceitar_conexoes(epoll_fd, escuta);
+                continue;
+            }
+
+            bool ok;
+            do {
+                ok = conexao_ler(registro, c);
+                // As respostas de todas as requisições lidas saem juntas
+                if (ok && c->saida.tamanho > c->enviado)
+                    ok = conexao_enviar(epoll_fd, c);
+                // Com a saída esvaziada, segue com as requisições que esperavam por ela
+            } while (ok && c->saida.tamanho == 0 && conexao_requisicao_pendente(c));
+            if (!ok || (c->fim_entrada && c->saida.tamanho == c->enviado))
+                conexao_fechar(epoll_fd, c);
+        }
+    }
+
+    // Conexões ainda abertas são encerradas junto com o processo
+    close(epoll_fd);
+    close(escuta);
+    unlink(argv[1]);
+    registro_apagar(&registro);
+    return 0;
+}
@@ -0,0 +1,12 @@
+#include <stdio.h>
+#include "Splay.h"
+
+// Instância do modelo da árvore splay para chaves int (a API declarada em Splay.h)
+#define SPLAY_CHAVE int
+#define SPLAY_PREFIXO splay
+#define SPLAY_TIPO SPLAY
+#define SPLAY_ITERADOR_TIPO SPLAY_ITERADOR
+#define SPLAY_IMPRIMIR_CHAVE(c) printf("%d ", (c))
+#define SPLAY_MODELO_SEM_DECLARACOES
+#define SPLAY_MODELO_IMPLEMENTAR
+#include "Splay_modelo.h"
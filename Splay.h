@@ -0,0 +1,97 @@
+#ifndef _ARVORE_SPLAY_H
+#define _ARVORE_SPLAY_H
+
+#include <stdbool.h>
+#include "Alocador.h"
+
+// Árvore splay autoajustável: os acessos levam a chave até a raiz, de modo que chaves
+// muito acessadas ficam perto do topo. Indicada para cargas com poucos
+// elementos concentrando a maior parte das consultas (distribuições de Zipf).
+
+// Definição da estrutura da árvore splay (a estrutura é definida aqui de forma abstrata)
+typedef struct splay SPLAY;
+
+// Iterador em ordem crescente sobre as chaves de uma árvore splay
+typedef struct splay_iterador SPLAY_ITERADOR;
+
+// Protótipos das funções para manipulação da árvore splay com chaves int
+// (geradas a partir de Splay_modelo.h; outros tipos de chave estão em Chaves.h)
+
+// Cria uma árvore splay vazia
+SPLAY *splay_criar(void);
+
+// Cria uma árvore splay vazia cujos nós e cabeçalho vêm de 'mem' (veja Alocador.h)
+SPLAY *splay_criar_com_alocador(ALOCADOR *mem);
+
+// Retorna o alocador usado pela árvore
+ALOCADOR *splay_alocador(SPLAY *T);
+
+// Libera toda a memória usada pela árvore
+void splay_apagar(SPLAY **T);
+
+// Insere uma chave, que passa a ser a raiz
+// (retorna false, sem alterar a árvore, se a chave já existir)
+bool splay_inserir(SPLAY *T, int chave);
+
+// Verifica se uma chave pertence à árvore; a cada algumas buscas bem-sucedidas a chave
+// encontrada é levada até a raiz (nós compartilhados com clones não são reorganizados)
+bool splay_pertence(SPLAY *T, int chave);
+
+// Remove uma chave (retorna false, sem alterar a árvore, se a chave não existir)
+bool splay_remover(SPLAY *T, int chave);
+
+// Imprime as chaves em ordem crescente
+void splay_imprimir(SPLAY *T);
+
+// Cria uma cópia (clone) da árvore em O(1); os nós são compartilhados
+// e copiados sob demanda quando uma das árvores for alterada
+SPLAY *splay_clonar(SPLAY *A);
+
+// Faz a união de duas árvores (o resultado compartilha com A as subárvores que não mudaram)
+SPLAY *splay_uniao(SPLAY *A, SPLAY *B);
+
+// Faz a interseção de duas árvores (o resultado compartilha com A as subárvores que não mudaram)
+SPLAY *splay_interseccao(SPLAY *A, SPLAY *B);
+
+// União e interseção dentro de A em O(n + m), sem criar outra árvore; os nós que saem
+// são liberados de uma vez. As versões "_consumindo" reaproveitam os nós de B em vez de
+// alocar novos e apagam B (*B vira NULL). Retornam false se faltar memória
+bool splay_uniao_em(SPLAY *A, SPLAY *B);
+bool splay_interseccao_em(SPLAY *A, SPLAY *B);
+bool splay_uniao_em_consumindo(SPLAY *A, SPLAY **B);
+bool splay_interseccao_em_consumindo(SPLAY *A, SPLAY **B);
+
+// Verifica a ordem das chaves; preenche a quantidade de chaves e a profundidade real
+// e retorna o número de violações
+int splay_auditar(SPLAY *T, int *elementos, int *profundidade);
+
+// Reconstrói a árvore com balanceamento perfeito em O(n); retorna false se faltar memória
+bool splay_rebalancear(SPLAY *T);
+
+// Substitui o conteúdo da árvore pelas 'n' chaves em ordem estritamente crescente, em O(n)
+// (carga em bloco); retorna false, sem alterar a árvore, se a ordem não for respeitada
+bool splay_carregar_ordenadas(SPLAY *T, const int *chaves, int n);
+
+// Menor e maior chave em O(1) (guardadas na árvore); retornam false se ela estiver vazia
+bool splay_minimo(SPLAY *T, int *chave);
+bool splay_maximo(SPLAY *T, int *chave);
+
+// Vizinhos de 'chave' em O(log n), que não precisa estar na árvore: sucessor (menor chave
+// maior), antecessor (maior chave menor), piso (maior chave <= chave) e teto (menor chave
+// >= chave). Retornam false se o vizinho não existir (não reorganizam a árvore)
+bool splay_sucessor(SPLAY *T, int chave, int *resultado);
+bool splay_antecessor(SPLAY *T, int chave, int *resultado);
+bool splay_piso(SPLAY *T, int chave, int *resultado);
+bool splay_teto(SPLAY *T, int chave, int *resultado);
+
+// Cria um iterador em ordem sobre a árvore (a árvore não pode ser alterada nem
+// consultada enquanto ele existir, pois as consultas também a reorganizam)
+SPLAY_ITERADOR *splay_iterador_criar(SPLAY *T);
+
+// Avança o iterador; retorna false quando não há mais chaves
+bool splay_iterador_proximo(SPLAY_ITERADOR *it, int *chave);
+
+// Libera o iterador
+void splay_iterador_apagar(SPLAY_ITERADOR **it);
+
+#endif
@@ -0,0 +1,954 @@
+// Modelo (template) da árvore splay, instanciado por macros para cada tipo de chave.
+// Cada instância tem seu próprio layout de nó e sua comparação expandida em linha,
+// sem ponteiros genéricos nem chamadas indiretas nas comparações.
+//
+// A árvore splay não guarda informação de balanceamento: os acessos trazem a chave até
+// a raiz (splay de cima para baixo), então chaves muito consultadas ficam perto do topo
+// e custam O(log(1/p)) amortizado, onde p é a frequência de acesso. As buscas fazem o
+// splay só de vez em quando (splay por amostragem, ver SPLAY_INTERVALO): uma chave
+// quente é reorganizada logo, enquanto as frias raramente pagam as escritas.
+// Como a busca também reorganiza a árvore, a árvore não pode ser consultada enquanto
+// houver um iterador sobre ela. Nós compartilhados com clones nunca são reorganizados
+// por buscas (a busca só faz splay se todo o caminho pertencer apenas a esta árvore).
+//
+// Parâmetros (definidos antes de incluir este arquivo, que os apaga no final):
+//   SPLAY_CHAVE                tipo da chave (ex.: int, int64_t, uma struct pequena)
+//   SPLAY_PREFIXO              prefixo das funções e da struct da árvore (ex.: splay -> splay_inserir)
+//   SPLAY_TIPO                 nome do tipo da árvore (ex.: SPLAY)
+//   SPLAY_ITERADOR_TIPO        nome do tipo do iterador (ex.: SPLAY_ITERADOR)
+//   SPLAY_COMPARAR(a, b)       opcional: negativo, zero ou positivo; padrão usa < e >
+//   SPLAY_IMPRIMIR_CHAVE(c)    imprime uma chave seguida de espaço
+//   SPLAY_INTERVALO            opcional: faz splay em uma a cada N buscas bem-sucedidas (padrão 8;
+//                              1 é a árvore splay clássica). Inserções e remoções sempre fazem splay
+//   SPLAY_MODELO_SEM_DECLARACOES  não gera os tipos e protótipos (já declarados em outro cabeçalho)
+//   SPLAY_MODELO_IMPLEMENTAR      gera as definições das funções (em um único .c por instância)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "Alocador.h"
+
+#if !defined(SPLAY_CHAVE) || !defined(SPLAY_PREFIXO) || !defined(SPLAY_TIPO) || !defined(SPLAY_ITERADOR_TIPO)
+#error "Defina SPLAY_CHAVE, SPLAY_PREFIXO, SPLAY_TIPO e SPLAY_ITERADOR_TIPO antes de incluir Splay_modelo.h"
+#endif
+
+#ifndef SPLAY_COMPARAR
+#define SPLAY_COMPARAR(a, b) (((a) > (b)) - ((a) < (b)))
+#endif
+
+#define SPLAY_CONCATENAR_(a, b) a##_##b
+#define SPLAY_CONCATENAR(a, b) SPLAY_CONCATENAR_(a, b)
+#define SPLAY_F(nome) SPLAY_CONCATENAR(SPLAY_PREFIXO, nome) // Nome da função nesta instância
+#define SPLAY_MENOR(a, b) (SPLAY_COMPARAR(a, b) < 0)
+#ifndef SPLAY_INTERVALO
+#define SPLAY_INTERVALO 8
+#endif
+#define SPLAY_IGUAL(a, b) (SPLAY_COMPARAR(a, b) == 0)
+
+#ifndef SPLAY_MODELO_SEM_DECLARACOES
+
+// Tipos da árvore e do iterador em ordem crescente
+typedef struct SPLAY_PREFIXO SPLAY_TIPO;
+typedef struct SPLAY_F(iterador) SPLAY_ITERADOR_TIPO;
+
+// Cria uma árvore splay vazia
+SPLAY_TIPO *SPLAY_F(criar)(void);
+
+// Cria uma árvore splay vazia cujos nós e cabeçalho vêm de 'mem' (que ela retém); clones e
+// resultados de operações herdam o alocador de quem lhes dá os nós
+SPLAY_TIPO *SPLAY_F(criar_com_alocador)(ALOCADOR *mem);
+
+// Alocador usado pela árvore
+ALOCADOR *SPLAY_F(alocador)(SPLAY_TIPO *T);
+
+// Libera toda a memória usada pela árvore
+void SPLAY_F(apagar)(SPLAY_TIPO **T);
+
+// Insere uma chave; a chave inserida passa a ser a raiz (false se ela já existir)
+bool SPLAY_F(inserir)(SPLAY_TIPO *T, SPLAY_CHAVE chave);
+
+// Verifica se uma chave pertence à árvore; se pertencer, ela pode ser levada até a raiz
+bool SPLAY_F(pertence)(SPLAY_TIPO *T, SPLAY_CHAVE chave);
+
+// Remove uma chave (false se ela não existir)
+bool SPLAY_F(remover)(SPLAY_TIPO *T, SPLAY_CHAVE chave);
+
+// Imprime as chaves em ordem crescente
+void SPLAY_F(imprimir)(SPLAY_TIPO *T);
+
+// Cria uma cópia (clone) da árvore em O(1); os nós são compartilhados
+// e copiados sob demanda quando uma das árvores for alterada
+SPLAY_TIPO *SPLAY_F(clonar)(SPLAY_TIPO *A);
+
+// Faz a união de duas árvores (compartilha com A as subárvores que não mudaram)
+SPLAY_TIPO *SPLAY_F(uniao)(SPLAY_TIPO *A, SPLAY_TIPO *B);
+
+// Faz a interseção de duas árvores (compartilha com A as subárvores que não mudaram)
+SPLAY_TIPO *SPLAY_F(interseccao)(SPLAY_TIPO *A, SPLAY_TIPO *B);
+
+// União e interseção dentro de A em O(n + m): A passa a conter o resultado, sem criar outra
+// árvore, e os nós descartados são liberados de uma vez. Nas versões que consomem B, os nós
+// de B são reaproveitados em A (sem alocar) se os alocadores forem compatíveis (veja
+// alocador_compativel), e B é apagada (*B vira NULL; B deve ser diferente de A). Retornam
+// false se faltar memória, sem alterar o conteúdo de A
+bool SPLAY_F(uniao_em)(SPLAY_TIPO *A, SPLAY_TIPO *B);
+bool SPLAY_F(interseccao_em)(SPLAY_TIPO *A, SPLAY_TIPO *B);
+bool SPLAY_F(uniao_em_consumindo)(SPLAY_TIPO *A, SPLAY_TIPO **B);
+bool SPLAY_F(interseccao_em_consumindo)(SPLAY_TIPO *A, SPLAY_TIPO **B);
+
+// Verifica a ordem das chaves; preenche a quantidade de chaves e a profundidade real
+// e retorna o número de violações encontradas
+int SPLAY_F(auditar)(SPLAY_TIPO *T, int *elementos, int *profundidade);
+
+// Reconstrói a árvore com balanceamento perfeito em O(n), remontando os próprios nós sem
+// alocar; só os nós que ela divide com clones são copiados antes. Retorna false (sem
+// alterar as chaves da árvore) se faltar memória para essas cópias
+bool SPLAY_F(rebalancear)(SPLAY_TIPO *T);
+
+// Substitui o conteúdo da árvore pelas 'n' chaves de 'chaves', que devem estar em ordem
+// estritamente crescente, montando a árvore balanceada em O(n) (carga em bloco).
+// Retorna false (sem alterar a árvore) se a ordem não for respeitada ou faltar memória
+bool SPLAY_F(carregar_ordenadas)(SPLAY_TIPO *T, const SPLAY_CHAVE *chaves, int n);
+
+// Menor e maior chave em O(1) (guardadas na árvore); retornam false se ela estiver vazia
+bool SPLAY_F(minimo)(SPLAY_TIPO *T, SPLAY_CHAVE *chave);
+bool SPLAY_F(maximo)(SPLAY_TIPO *T, SPLAY_CHAVE *chave);
+
+// Vizinhos de 'chave' em O(log n), que não precisa estar na árvore: menor chave > chave
+// (sucessor), maior chave < chave (antecessor), maior chave <= chave (piso) e menor
+// chave >= chave (teto), sem reorganizar a árvore. Preenchem '*resultado' e retornam false se ele não existir
+bool SPLAY_F(sucessor)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado);
+bool SPLAY_F(antecessor)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado);
+bool SPLAY_F(piso)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado);
+bool SPLAY_F(teto)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado);
+
+// Cria um iterador em ordem sobre a árvore (a árvore não pode ser alterada nem
+// consultada enquanto ele existir)
+SPLAY_ITERADOR_TIPO *SPLAY_F(iterador_criar)(SPLAY_TIPO *T);
+
+// Avança o iterador; retorna false quando não há mais chaves
+bool SPLAY_F(iterador_proximo)(SPLAY_ITERADOR_TIPO *it, SPLAY_CHAVE *chave);
+
+// Libera o iterador
+void SPLAY_F(iterador_apagar)(SPLAY_ITERADOR_TIPO **it);
+
+#endif // SPLAY_MODELO_SEM_DECLARACOES
+
+#ifdef SPLAY_MODELO_IMPLEMENTAR
+
+#ifndef SPLAY_IMPRIMIR_CHAVE
+#error "Defina SPLAY_IMPRIMIR_CHAVE para implementar uma instância de Splay_modelo.h"
+#endif
+
+#define SPLAY_NO struct SPLAY_F(no)
+
+// Estrutura do nó da árvore splay
+struct SPLAY_F(no) {
+    SPLAY_CHAVE chave; // Chave do nó
+    SPLAY_NO *esq;     // Filho esquerdo
+    SPLAY_NO *dir;     // Filho direito
+    int ref;           // Quantidade de referências (pais ou raízes de árvores) que compartilham o nó
+};
+
+// Estrutura da árvore splay
+struct SPLAY_PREFIXO {
+    SPLAY_NO *raiz;   // Raiz da árvore (a última chave reorganizada)
+    unsigned acessos; // Buscas bem-sucedidas desde o último splay feito por uma busca
+    SPLAY_CHAVE minimo; // Menor chave (válida se a raiz não for NULL); são guardados valores e não
+    SPLAY_CHAVE maximo; // nós, pois os nós das pontas mudam quando um caminho compartilhado é copiado
+    ALOCADOR *mem;      // Origem dos nós e do cabeçalho, compartilhada com os clones
+};
+
+//! Cria uma árvore splay vazia com nós alocados por 'mem'
+SPLAY_TIPO *SPLAY_F(criar_com_alocador)(ALOCADOR *mem) {
+    if (mem == NULL) return NULL;
+    SPLAY_TIPO *T = (SPLAY_TIPO *)alocador_alocar(mem, sizeof(SPLAY_TIPO));
+    if (T == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    T->raiz = NULL;
+    T->acessos = 0;
+    T->mem = alocador_reter(mem);
+    return T;
+}
+
+//! Cria uma árvore splay vazia, com malloc e free
+SPLAY_TIPO *SPLAY_F(criar)(void) {
+    ALOCADOR *mem = alocador_criar(NULL);
+    SPLAY_TIPO *T = SPLAY_F(criar_com_alocador)(mem);
+    alocador_soltar(&mem); // A árvore ficou com a única referência
+    return T;
+}
+
+//! Alocador usado pela árvore
+ALOCADOR *SPLAY_F(alocador)(SPLAY_TIPO *T) {
+    return T ? T->mem : NULL;
+}
+
+// Cria um nó com a chave fornecida
+static SPLAY_NO *SPLAY_F(criar_no)(ALOCADOR *mem, SPLAY_CHAVE chave) {
+    SPLAY_NO *no = (SPLAY_NO *)alocador_alocar(mem, sizeof(SPLAY_NO));
+    if (no) {
+        no->chave = chave;
+        no->esq = no->dir = NULL;
+        no->ref = 1; // O nó começa referenciado apenas por quem o criou
+    }
+    return no;
+}
+
+// Solta uma referência à subárvore, liberando os nós que ficarem sem referências.
+// A árvore splay pode ter altura linear, então não há recursão: os próprios nós
+// liberados guardam (no campo 'esq') a pilha das subárvores direitas pendentes
+static void SPLAY_F(apagar_no)(ALOCADOR *mem, SPLAY_NO *no) {
+    SPLAY_NO *pilha = NULL;
+    for (;;) {
+        if (no != NULL && --no->ref == 0) {
+            SPLAY_NO *esq = no->esq;
+            no->esq = pilha;
+            pilha = no;
+            no = esq;
+        } else if (pilha != NULL) {
+            SPLAY_NO *morto = pilha;
+            pilha = morto->esq;
+            no = morto->dir;
+            alocador_liberar(mem, morto, sizeof(SPLAY_NO));
+        } else {
+            break;
+        }
+    }
+}
+
+//! Apaga a árvore e libera a memória
+void SPLAY_F(apagar)(SPLAY_TIPO **T) {
+    if (T && *T) {
+        ALOCADOR *mem = (*T)->mem;
+        SPLAY_F(apagar_no)(mem, (*T)->raiz);
+        alocador_liberar(mem, *T, sizeof(SPLAY_TIPO));
+        alocador_soltar(&mem);
+        *T = NULL;
+    }
+}
+
+// Retorna uma versão do nó que pode ser alterada sem afetar outras árvores.
+// Se o nó for compartilhado, cria uma cópia que passa a compartilhar os filhos;
+// o resultado deve substituir o nó no mesmo ponteiro de onde ele foi lido. Retorna NULL
+// se faltar memória para a cópia (o nó não muda); por isso o splay só roda depois de
+// reservados os nós que ele pode precisar copiar (veja SPLAY_F(reservar))
+static SPLAY_NO *SPLAY_F(exclusivo)(ALOCADOR *mem, SPLAY_NO *no) {
+    if (no == NULL || no->ref == 1) return no;
+
+    SPLAY_NO *copia = SPLAY_F(criar_no)(mem, no->chave);
+    if (copia == NULL) return NULL;
+    copia->esq = no->esq;
+    copia->dir = no->dir;
+    if (copia->esq) copia->esq->ref++; // Os filhos ganham mais um pai
+    if (copia->dir) copia->dir->ref++;
+    no->ref--;                          // O original perde a referência que foi para a cópia
+    return copia;
+}
+
+// Quantidade de nós no caminho de busca da chave, que são os únicos que um splay por ela
+// pode copiar (a árvore splay pode ter altura linear, então o caminho é medido, e não estimado)
+static int SPLAY_F(caminho)(SPLAY_NO *no, SPLAY_CHAVE chave) {
+    int n = 0;
+    while (no != NULL) {
+        n++;
+        if (SPLAY_IGUAL(chave, no->chave)) break;
+        no = SPLAY_MENOR(chave, no->chave) ? no->esq : no->dir;
+    }
+    return n;
+}
+
+// Garante memória para um splay pela chave na subárvore 'raiz' copiar todo o caminho, mais
+// 'extra' nós, para que ele não falhe pela metade. Uma árvore que não divide o alocador com
+// nenhuma outra não tem nós compartilhados e não reserva nada
+static bool SPLAY_F(reservar)(SPLAY_TIPO *T, SPLAY_NO *raiz, SPLAY_CHAVE chave, int extra) {
+    if (!alocador_compartilhado(T->mem)) return true;
+    return alocador_reservar(T->mem, SPLAY_F(caminho)(raiz, chave) + extra, sizeof(SPLAY_NO));
+}
+
+// Splay de cima para baixo: reorganiza a subárvore para que a chave (ou o último nó do
+// caminho de busca, se ela não existir) fique na raiz. Os nós do caminho são copiados
+// se forem compartilhados, com a memória já reservada (ou sem cópias, se o caminho for
+// exclusivo); o resultado substitui 'raiz' no ponteiro de onde ela foi lida
+static SPLAY_NO *SPLAY_F(splay)(ALOCADOR *mem, SPLAY_NO *raiz, SPLAY_CHAVE chave) {
+    if (raiz == NULL) return NULL;
+
+    SPLAY_NO cabeca;                    // Raiz provisória das árvores esquerda e direita
+    SPLAY_NO *esq = &cabeca, *dir = &cabeca; // Pontos de inserção das árvores esquerda e direita
+    cabeca.esq = cabeca.dir = NULL;
+
+    SPLAY_NO *t = SPLAY_F(exclusivo)(mem, raiz);
+    for (;;) {
+        if (SPLAY_MENOR(chave, t->chave)) {
+            if (t->esq == NULL) break;
+            t->esq = SPLAY_F(exclusivo)(mem, t->esq);
+            if (SPLAY_MENOR(chave, t->esq->chave)) { // Zig-zig: rotação à direita
+                SPLAY_NO *filho = t->esq;
+                t->esq = filho->dir;
+                filho->dir = t;
+                t = filho;
+                if (t->esq == NULL) break;
+                t->esq = SPLAY_F(exclusivo)(mem, t->esq);
+            }
+            dir->esq = t; // 't' e sua subárvore direita vão para a árvore direita
+            dir = t;
+            t = t->esq;
+        } else if (SPLAY_MENOR(t->chave, chave)) {
+            if (t->dir == NULL) break;
+            t->dir = SPLAY_F(exclusivo)(mem, t->dir);
+            if (SPLAY_MENOR(t->dir->chave, chave)) { // Zag-zag: rotação à esquerda
+                SPLAY_NO *filho = t->dir;
+                t->dir = filho->esq;
+                filho->esq = t;
+                t = filho;
+                if (t->dir == NULL) break;
+                t->dir = SPLAY_F(exclusivo)(mem, t->dir);
+            }
+            esq->dir = t; // 't' e sua subárvore esquerda vão para a árvore esquerda
+            esq = t;
+            t = t->dir;
+        } else {
+            break;
+        }
+    }
+
+    // Monta a nova raiz com as árvores esquerda e direita
+    esq->dir = t->esq;
+    dir->esq = t->dir;
+    t->esq = cabeca.dir;
+    t->dir = cabeca.esq;
+    return t;
+}
+
+// Busca só de leitura; informa em '*exclusivo' se todo o caminho até a chave pertence
+// apenas a esta árvore (nenhum nó do caminho é compartilhado com um clone)
+static bool SPLAY_F(buscar)(SPLAY_NO *no, SPLAY_CHAVE chave, bool *exclusivo) {
+    int compartilhado = 0; // Acumulado em variável local para ficar em registrador
+    bool achou = false;
+    while (no != NULL) {
+        compartilhado |= no->ref > 1;
+        if (SPLAY_IGUAL(chave, no->chave)) {
+            achou = true;
+            break;
+        }
+        no = SPLAY_MENOR(chave, no->chave) ? no->esq : no->dir; // Escolha sem desvio (cmov)
+    }
+    *exclusivo = !compartilhado;
+    return achou;
+}
+
+// Recalcula a menor e a maior chave descendo pelas pontas da árvore
+static void SPLAY_F(atualizar_extremos)(SPLAY_TIPO *T) {
+    SPLAY_NO *no = T->raiz;
+    if (no == NULL) return;
+    while (no->esq != NULL) no = no->esq;
+    T->minimo = no->chave;
+    no = T->raiz;
+    while (no->dir != NULL) no = no->dir;
+    T->maximo = no->chave;
+}
+
+//! Insere uma chave na árvore; a nova chave vira a raiz
+bool SPLAY_F(inserir)(SPLAY_TIPO *T, SPLAY_CHAVE chave) {
+    if (T == NULL) return false;
+
+    // Busca só de leitura primeiro: uma chave repetida não aloca nem altera a árvore
+    bool exclusivo;
+    if (SPLAY_F(buscar)(T->raiz, chave, &exclusivo)) return false;
+
+    // Toda a memória vem antes de alterar a árvore: o novo nó e, se o caminho tiver nós
+    // compartilhados, as cópias dele
+    if (!exclusivo && !SPLAY_F(reservar)(T, T->raiz, chave, 1)) return false;
+    SPLAY_NO *novo = SPLAY_F(criar_no)(T->mem, chave);
+    if (novo == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    if (T->raiz == NULL || SPLAY_MENOR(chave, T->minimo)) T->minimo = chave; // A nova chave pode ser
+    if (T->raiz == NULL || SPLAY_MENOR(T->maximo, chave)) T->maximo = chave; // uma das pontas
+    if (T->raiz != NULL) {
+        // Após o splay, a raiz é a vizinha da chave; ela e um dos lados passam para o novo nó
+        SPLAY_NO *raiz = SPLAY_F(splay)(T->mem, T->raiz, chave);
+        if (SPLAY_MENOR(chave, raiz->chave)) {
+            novo->esq = raiz->esq;
+            novo->dir = raiz;
+            raiz->esq = NULL;
+        } else {
+            novo->dir = raiz->dir;
+            novo->esq = raiz;
+            raiz->dir = NULL;
+        }
+    }
+    T->raiz = novo;
+    return true;
+}
+
+//! Verifica se a chave pertence à árvore, trazendo-a de vez em quando para a raiz
+bool SPLAY_F(pertence)(SPLAY_TIPO *T, SPLAY_CHAVE chave) {
+    if (T == NULL) return false;
+
+    bool exclusivo;
+    if (!SPLAY_F(buscar)(T->raiz, chave, &exclusivo)) return false; // Falhas não alteram a árvore
+
+    // O splay só é feito quando não exige copiar nós compartilhados com clones, para que
+    // uma consulta nunca aloque memória, e apenas em uma a cada SPLAY_INTERVALO buscas:
+    // chaves quentes sobem logo, e as frias raramente pagam a reorganização
+    if (exclusivo && !SPLAY_IGUAL(chave, T->raiz->chave) && ++T->acessos >= SPLAY_INTERVALO) {
+        T->acessos = 0;
+        T->raiz = SPLAY_F(splay)(T->mem, T->raiz, chave);
+    }
+    return true;
+}
+
+//! Remove uma chave da árvore
+bool SPLAY_F(remover)(SPLAY_TIPO *T, SPLAY_CHAVE chave) {
+    if (T == NULL) return false;
+
+    // Busca só de leitura primeiro: remover uma chave ausente não altera a árvore
+    bool exclusivo;
+    if (!SPLAY_F(buscar)(T->raiz, chave, &exclusivo)) return false;
+    if (!exclusivo && !SPLAY_F(reservar)(T, T->raiz, chave, 0)) return false;
+
+    SPLAY_NO *raiz = T->raiz = SPLAY_F(splay)(T->mem, T->raiz, chave); // A chave vira a raiz
+    if (raiz->esq == NULL) {
+        T->raiz = raiz->dir;
+    } else {
+        // A maior chave da subárvore esquerda sobe e fica sem filho direito. O caminho dela
+        // só é conhecido depois do primeiro splay; se faltar memória para copiá-lo, a árvore
+        // fica como o primeiro splay a deixou, com as mesmas chaves
+        if (!SPLAY_F(reservar)(T, raiz->esq, chave, 0)) return false;
+        T->raiz = SPLAY_F(splay)(T->mem, raiz->esq, chave);
+        T->raiz->dir = raiz->dir;
+    }
+    alocador_liberar(T->mem, raiz, sizeof(SPLAY_NO)); // A raiz antiga é exclusiva e seus filhos já foram repassados
+    if (SPLAY_IGUAL(chave, T->minimo) || SPLAY_IGUAL(chave, T->maximo)) {
+        SPLAY_F(atualizar_extremos)(T); // Saiu uma das pontas: desce até a nova
+    }
+    return true;
+}
+
+//! Imprime as chaves em ordem crescente
+void SPLAY_F(imprimir)(SPLAY_TIPO *T) {
+    if (T == NULL || T->raiz == NULL) {
+        printf("Arvore vazia.\n");
+        return;
+    }
+    SPLAY_ITERADOR_TIPO *it = SPLAY_F(iterador_criar)(T);
+    SPLAY_CHAVE chave;
+    while (SPLAY_F(iterador_proximo)(it, &chave)) {
+        SPLAY_IMPRIMIR_CHAVE(chave);
+    }
+    SPLAY_F(iterador_apagar)(&it);
+}
+
+//! Clona a árvore em O(1): o clone compartilha todos os nós de A
+SPLAY_TIPO *SPLAY_F(clonar)(SPLAY_TIPO *A) {
+    if (A == NULL) return SPLAY_F(criar)();
+    SPLAY_TIPO *clone = SPLAY_F(criar_com_alocador)(A->mem); // Os nós compartilhados vêm do mesmo alocador
+    if (clone == NULL) return NULL;
+
+    clone->raiz = A->raiz; // Alterações futuras em qualquer uma das árvores copiam só o caminho
+    clone->minimo = A->minimo;
+    clone->maximo = A->maximo;
+    if (clone->raiz) clone->raiz->ref++;
+    return clone;
+}
+
+//! União: parte de um clone de A e insere as chaves de B em ordem crescente
+//! (inserções em ordem custam O(1) amortizado na árvore splay)
+SPLAY_TIPO *SPLAY_F(uniao)(SPLAY_TIPO *A, SPLAY_TIPO *B) {
+    SPLAY_TIPO *uniao = SPLAY_F(clonar)(A);
+    if (uniao == NULL || B == NULL) return uniao;
+
+    SPLAY_ITERADOR_TIPO *it = SPLAY_F(iterador_criar)(B);
+    if (it == NULL) {
+        SPLAY_F(apagar)(&uniao);
+        return NULL;
+    }
+    SPLAY_CHAVE chave;
+    while (SPLAY_F(iterador_proximo)(it, &chave)) {
+        SPLAY_F(inserir)(uniao, chave);
+    }
+    SPLAY_F(iterador_apagar)(&it);
+    return uniao;
+}
+
+//! Interseção: parte de um clone de A e remove as chaves de A ausentes em B.
+//! A e B são percorridas juntas em ordem, sem buscas (que reorganizariam B)
+SPLAY_TIPO *SPLAY_F(interseccao)(SPLAY_TIPO *A, SPLAY_TIPO *B) {
+    if (A == NULL) return SPLAY_F(criar)();
+    if (B == NULL) return SPLAY_F(criar_com_alocador)(A->mem);
+
+    SPLAY_TIPO *interseccao = SPLAY_F(clonar)(A);
+    SPLAY_ITERADOR_TIPO *ia = SPLAY_F(iterador_criar)(A);
+    SPLAY_ITERADOR_TIPO *ib = SPLAY_F(iterador_criar)(B);
+    if (interseccao == NULL || ia == NULL || ib == NULL) {
+        SPLAY_F(iterador_apagar)(&ia);
+        SPLAY_F(iterador_apagar)(&ib);
+        SPLAY_F(apagar)(&interseccao);
+        return NULL;
+    }
+
+    SPLAY_CHAVE a, b;
+    bool tem_b = SPLAY_F(iterador_proximo)(ib, &b);
+    while (SPLAY_F(iterador_proximo)(ia, &a)) {
+        while (tem_b && SPLAY_MENOR(b, a)) {
+            tem_b = SPLAY_F(iterador_proximo)(ib, &b);
+        }
+        if (!tem_b || !SPLAY_IGUAL(a, b)) {
+            SPLAY_F(remover)(interseccao, a); // A não é alterada: o clone copia o caminho
+        }
+    }
+    SPLAY_F(iterador_apagar)(&ia);
+    SPLAY_F(iterador_apagar)(&ib);
+    return interseccao;
+}
+
+// Pilha de nós com suas profundidades, usada pela auditoria
+typedef struct {
+    SPLAY_NO *no;
+    int nivel;
+} SPLAY_F(pendente);
+
+//! Verifica a ordem das chaves e mede a profundidade da árvore (sem recursão,
+//! pois a árvore splay pode ter altura linear)
+int SPLAY_F(auditar)(SPLAY_TIPO *T, int *elementos, int *profundidade) {
+    *elementos = *profundidade = 0;
+    if (T == NULL || T->raiz == NULL) return 0;
+
+    int violacoes = 0, topo = 0, capacidade = 64;
+    SPLAY_F(pendente) *pilha = (SPLAY_F(pendente) *)malloc(capacidade * sizeof(SPLAY_F(pendente)));
+    if (pilha == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return 0;
+    }
+
+    // Percurso em ordem: cada chave deve ser maior que a anterior
+    bool tem_anterior = false;
+    SPLAY_CHAVE anterior;
+    SPLAY_NO *no = T->raiz;
+    int nivel = 1;
+    while (no != NULL || topo > 0) {
+        while (no != NULL) {
+            if (topo == capacidade) {
+                SPLAY_F(pendente) *maior = (SPLAY_F(pendente) *)realloc(pilha, 2 * capacidade * sizeof(SPLAY_F(pendente)));
+                if (maior == NULL) {
+                    fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+                    free(pilha);
+                    return violacoes;
+                }
+                pilha = maior;
+                capacidade *= 2;
+            }
+            pilha[topo].no = no;
+            pilha[topo++].nivel = nivel;
+            if (nivel > *profundidade) *profundidade = nivel;
+            no = no->esq;
+            nivel++;
+        }
+        topo--;
+        no = pilha[topo].no;
+        nivel = pilha[topo].nivel;
+        (*elementos)++;
+        if (tem_anterior && !SPLAY_MENOR(anterior, no->chave)) violacoes++; // Chave fora de ordem
+        anterior = no->chave;
+        tem_anterior = true;
+        no = no->dir;
+        nivel++;
+    }
+    free(pilha);
+    return violacoes;
+}
+
+// Constrói uma árvore perfeitamente balanceada com as 'n' chaves ordenadas: a chave do
+// meio vira a raiz e cada metade vira uma subárvore. '*ok' vira false se faltar memória
+static SPLAY_NO *SPLAY_F(construir)(ALOCADOR *mem, const SPLAY_CHAVE *chaves, int n, bool *ok) {
+    if (n <= 0 || !*ok) return NULL;
+
+    int meio = n / 2;
+    SPLAY_NO *no = SPLAY_F(criar_no)(mem, chaves[meio]);
+    if (no == NULL) {
+        *ok = false;
+        return NULL;
+    }
+    no->esq = SPLAY_F(construir)(mem, chaves, meio, ok);
+    no->dir = SPLAY_F(construir)(mem, chaves + meio + 1, n - meio - 1, ok);
+    return no;
+}
+
+// Transforma a árvore '*raiz' em uma "vinha": lista em ordem crescente encadeada pelo
+// ponteiro 'dir', feita por rotações à direita, sem pilha (Day-Stout-Warren). Os nós
+// compartilhados com clones são copiados antes de mudar. Se faltar memória para uma cópia,
+// para e retorna false: as rotações já feitas preservam a ordem, então '*raiz' continua
+// sendo uma árvore válida com as mesmas chaves, só com outra forma
+static bool SPLAY_F(vinha)(ALOCADOR *mem, SPLAY_NO **raiz) {
+    SPLAY_NO cabeca;
+    SPLAY_NO *cauda = &cabeca, *copia;
+    bool ok = true;
+    cabeca.dir = *raiz;
+    while (cauda->dir != NULL) {
+        if ((copia = SPLAY_F(exclusivo)(mem, cauda->dir)) == NULL) {
+            ok = false;
+            break;
+        }
+        SPLAY_NO *resto = cauda->dir = copia;
+        if (resto->esq == NULL) {
+            cauda = resto; // Já está na lista; avança
+        } else {
+            if ((copia = SPLAY_F(exclusivo)(mem, resto->esq)) == NULL) {
+                ok = false;
+                break;
+            }
+            SPLAY_NO *esq = copia;
+            resto->esq = esq->dir; // Rotação à direita sobre 'resto'
+            esq->dir = resto;
+            cauda->dir = esq;
+        }
+    }
+    *raiz = cabeca.dir;
+    return ok;
+}
+
+// Monta uma árvore perfeitamente balanceada com os 'n' primeiros nós da vinha '*lista',
+// reaproveitando os próprios nós, e avança '*lista'
+static SPLAY_NO *SPLAY_F(construir_vinha)(SPLAY_NO **lista, int n) {
+    if (n <= 0) return NULL;
+
+    SPLAY_NO *esq = SPLAY_F(construir_vinha)(lista, n / 2);
+    SPLAY_NO *no = *lista;
+    *lista = no->dir;
+    no->esq = esq;
+    no->dir = SPLAY_F(construir_vinha)(lista, n - n / 2 - 1);
+    return no;
+}
+
+//! Reconstrói a árvore com balanceamento perfeito em O(n), reaproveitando os nós
+bool SPLAY_F(rebalancear)(SPLAY_TIPO *T) {
+    if (T == NULL || T->raiz == NULL) return T != NULL;
+
+    // A vinha copia só os nós que a árvore divide com clones; se faltar memória para eles,
+    // a árvore fica com as mesmas chaves em outra forma
+    if (!SPLAY_F(vinha)(T->mem, &T->raiz)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+
+    SPLAY_NO *lista = T->raiz;
+    int n = 0;
+    for (SPLAY_NO *no = lista; no != NULL; no = no->dir) n++;
+    T->raiz = SPLAY_F(construir_vinha)(&lista, n);
+    return true;
+}
+
+// Próxima chave de B: da vinha '*vinha_b' (o nó sai da lista e vai para '*no') ou,
+// se ela não existir, do iterador 'it' (e '*no' fica NULL)
+static bool SPLAY_F(proximo_b)(SPLAY_NO **vinha_b, SPLAY_ITERADOR_TIPO *it, SPLAY_CHAVE *chave, SPLAY_NO **no) {
+    if (it != NULL) {
+        *no = NULL;
+        return SPLAY_F(iterador_proximo)(it, chave);
+    }
+    if (*vinha_b == NULL) return false;
+    *no = *vinha_b;
+    *vinha_b = (*no)->dir;
+    *chave = (*no)->chave;
+    return true;
+}
+
+// União ou interseção feita dentro de A: a árvore de A, já transformada em vinha, é intercalada
+// em ordem com as chaves de B (vindas da vinha 'vinha_b', cujos nós são reaproveitados, ou
+// do iterador 'it_b'); os nós que sobram são liberados na mesma passada e o resultado é
+// remontado balanceado em O(n + m), sem splays
+static bool SPLAY_F(combinar_em)(SPLAY_TIPO *A, SPLAY_NO *vinha_b, SPLAY_ITERADOR_TIPO *it_b, bool uniao) {
+    ALOCADOR *mem = A->mem;
+    SPLAY_NO *a = A->raiz;
+    SPLAY_NO cabeca, *cauda = &cabeca, *no = NULL;
+    SPLAY_CHAVE chave = {0}; // Só é lida quando tem_b (iniciada para o otimizador não acusar uso sem valor)
+    bool ok = true;
+    int n = 0;
+
+    bool tem_b = SPLAY_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+    while (a != NULL || tem_b) {
+        if (a == NULL || (tem_b && SPLAY_MENOR(chave, a->chave))) {
+            // Chave só de B: entra na união (com o nó de B ou um novo, já reservado) e some da interseção
+            if (uniao) {
+                if (no == NULL && (no = SPLAY_F(criar_no)(mem, chave)) == NULL) {
+                    ok = false;
+                } else {
+                    cauda = cauda->dir = no;
+                    n++;
+                }
+            } else {
+                alocador_liberar(mem, no, sizeof(SPLAY_NO));
+            }
+            tem_b = SPLAY_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+        } else {
+            SPLAY_NO *proximo = a->dir;
+            if (tem_b && SPLAY_IGUAL(chave, a->chave)) {
+                alocador_liberar(mem, no, sizeof(SPLAY_NO)); // Chave dos dois lados: fica o nó de A
+                tem_b = SPLAY_F(proximo_b)(&vinha_b, it_b, &chave, &no);
+                cauda = cauda->dir = a;
+                n++;
+            } else if (uniao) {
+                cauda = cauda->dir = a; // Chave só de A
+                n++;
+            } else {
+                alocador_liberar(mem, a, sizeof(SPLAY_NO));
+            }
+            a = proximo;
+        }
+    }
+    cauda->dir = NULL;
+
+    SPLAY_NO *lista = cabeca.dir;
+    A->raiz = SPLAY_F(construir_vinha)(&lista, n);
+    SPLAY_F(atualizar_extremos)(A);
+    if (!ok) fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+    return ok;
+}
+
+// Conta as chaves de B que faltam em A, percorrendo as duas em ordem: são os nós que a
+// união dentro de A precisa criar. Retorna -1 se faltar memória para os iteradores
+static int SPLAY_F(contar_novas)(SPLAY_TIPO *A, SPLAY_TIPO *B) {
+    SPLAY_ITERADOR_TIPO *it_a = SPLAY_F(iterador_criar)(A), *it_b = SPLAY_F(iterador_criar)(B);
+    int novas = -1;
+    if (it_a != NULL && it_b != NULL) {
+        SPLAY_CHAVE a = {0}, b = {0};
+        bool tem_a = SPLAY_F(iterador_proximo)(it_a, &a), tem_b = SPLAY_F(iterador_proximo)(it_b, &b);
+        novas = 0;
+        while (tem_b) {
+            if (!tem_a || SPLAY_MENOR(b, a)) {
+                novas++;
+                tem_b = SPLAY_F(iterador_proximo)(it_b, &b);
+            } else {
+                if (SPLAY_IGUAL(a, b)) tem_b = SPLAY_F(iterador_proximo)(it_b, &b);
+                tem_a = SPLAY_F(iterador_proximo)(it_a, &a);
+            }
+        }
+    }
+    SPLAY_F(iterador_apagar)(&it_a);
+    SPLAY_F(iterador_apagar)(&it_b);
+    return novas;
+}
+
+// Prepara a combinação com B sem alterá-lo: as chaves de B são lidas por um iterador
+static bool SPLAY_F(combinar_com)(SPLAY_TIPO *A, SPLAY_TIPO *B, bool uniao) {
+    if (A == NULL) return false;
+    if (A == B) return true; // A ∪ A = A ∩ A = A
+
+    // A é desmontada no lugar; se faltar memória para copiar seus nós compartilhados, fica
+    // com as mesmas chaves e a operação falha antes de mudar o conteúdo
+    if (!SPLAY_F(vinha)(A->mem, &A->raiz)) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    // A união cria um nó para cada chave que só B tem: eles são reservados antes da
+    // intercalação, e a falta de memória não deixa a união pela metade
+    int novas = uniao ? SPLAY_F(contar_novas)(A, B) : 0;
+    if (novas < 0 || (novas > 0 && !alocador_reservar(A->mem, novas, sizeof(SPLAY_NO)))) return false;
+    SPLAY_ITERADOR_TIPO *it = SPLAY_F(iterador_criar)(B);
+    if (it == NULL) return false;
+    bool ok = SPLAY_F(combinar_em)(A, NULL, it, uniao);
+    SPLAY_F(iterador_apagar)(&it);
+    return ok;
+}
+
+// Prepara a combinação consumindo B: a árvore de B vira uma vinha cujos nós são
+// movidos para A ou liberados, e a estrutura de B é apagada
+static bool SPLAY_F(combinar_consumindo)(SPLAY_TIPO *A, SPLAY_TIPO **B, bool uniao) {
+    if (A == NULL || B == NULL || *B == NULL || *B == A) return false;
+    // Os nós de B só mudam de dono se o alocador de A puder liberá-los, e os compartilhados
+    // só podem ser movidos depois de copiados; se não der para copiá-los, B é lida e apagada
+    ALOCADOR *mem_b = (*B)->mem;
+    if (!alocador_compativel(mem_b, A->mem) || !SPLAY_F(vinha)(mem_b, &(*B)->raiz) ||
+        !SPLAY_F(vinha)(A->mem, &A->raiz)) {
+        bool ok = SPLAY_F(combinar_com)(A, *B, uniao);
+        SPLAY_F(apagar)(B);
+        return ok;
+    }
+
+    SPLAY_NO *vinha_b = (*B)->raiz;
+    (*B)->raiz = NULL;
+    if (mem_b != A->mem) {
+        // Cada conjunto tem o seu alocador: os nós de B passam para a contabilidade de A
+        size_t n = 0;
+        for (SPLAY_NO *no = vinha_b; no != NULL; no = no->dir) n++;
+        alocador_transferir(mem_b, A->mem, n * sizeof(SPLAY_NO));
+    }
+    SPLAY_F(apagar)(B);
+    return SPLAY_F(combinar_em)(A, vinha_b, NULL, uniao);
+}
+
+//! A recebe a união de A e B; B não é alterada
+bool SPLAY_F(uniao_em)(SPLAY_TIPO *A, SPLAY_TIPO *B) {
+    return SPLAY_F(combinar_com)(A, B, true);
+}
+
+//! A recebe a interseção de A e B; B não é alterada
+bool SPLAY_F(interseccao_em)(SPLAY_TIPO *A, SPLAY_TIPO *B) {
+    return SPLAY_F(combinar_com)(A, B, false);
+}
+
+//! A recebe a união de A e B, reaproveitando os nós de B; B é apagada
+bool SPLAY_F(uniao_em_consumindo)(SPLAY_TIPO *A, SPLAY_TIPO **B) {
+    return SPLAY_F(combinar_consumindo)(A, B, true);
+}
+
+//! A recebe a interseção de A e B; os nós de B são liberados e B é apagada
+bool SPLAY_F(interseccao_em_consumindo)(SPLAY_TIPO *A, SPLAY_TIPO **B) {
+    return SPLAY_F(combinar_consumindo)(A, B, false);
+}
+
+//! Carrega a árvore em bloco a partir de chaves já ordenadas
+bool SPLAY_F(carregar_ordenadas)(SPLAY_TIPO *T, const SPLAY_CHAVE *chaves, int n) {
+    if (T == NULL || n < 0) return false;
+    for (int i = 1; i < n; i++) {
+        if (!SPLAY_MENOR(chaves[i - 1], chaves[i])) return false; // Fora de ordem ou repetida
+    }
+
+    bool ok = true;
+    SPLAY_NO *raiz = SPLAY_F(construir)(T->mem, chaves, n, &ok);
+    if (!ok) {
+        SPLAY_F(apagar_no)(T->mem, raiz);
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return false;
+    }
+    SPLAY_F(apagar_no)(T->mem, T->raiz);
+    T->raiz = raiz;
+    if (n > 0) {
+        T->minimo = chaves[0];
+        T->maximo = chaves[n - 1];
+    }
+    return true;
+}
+
+//! Retorna a menor chave da árvore em O(1)
+bool SPLAY_F(minimo)(SPLAY_TIPO *T, SPLAY_CHAVE *chave) {
+    if (T == NULL || T->raiz == NULL) return false;
+    *chave = T->minimo;
+    return true;
+}
+
+//! Retorna a maior chave da árvore em O(1)
+bool SPLAY_F(maximo)(SPLAY_TIPO *T, SPLAY_CHAVE *chave) {
+    if (T == NULL || T->raiz == NULL) return false;
+    *chave = T->maximo;
+    return true;
+}
+
+// Desce uma vez da raiz procurando a chave mais próxima de 'chave' acima dela ('acima')
+// ou abaixo; se 'inclusivo', a própria chave também serve
+static bool SPLAY_F(vizinho)(SPLAY_TIPO *T, SPLAY_CHAVE chave, bool acima, bool inclusivo, SPLAY_CHAVE *resultado) {
+    bool achou = false;
+    SPLAY_NO *no = T ? T->raiz : NULL;
+    while (no != NULL) {
+        int c = SPLAY_COMPARAR(no->chave, chave);
+        if (c == 0 && inclusivo) {
+            *resultado = no->chave;
+            return true;
+        }
+        if (acima ? c > 0 : c < 0) {
+            *resultado = no->chave; // Candidata; pode haver outra mais próxima no lado de dentro
+            achou = true;
+            no = acima ? no->esq : no->dir;
+        } else {
+            no = acima ? no->dir : no->esq;
+        }
+    }
+    return achou;
+}
+
+//! Menor chave maior que 'chave' (as consultas de vizinhos não reorganizam a árvore)
+bool SPLAY_F(sucessor)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado) {
+    return SPLAY_F(vizinho)(T, chave, true, false, resultado);
+}
+
+//! Maior chave menor que 'chave'
+bool SPLAY_F(antecessor)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado) {
+    return SPLAY_F(vizinho)(T, chave, false, false, resultado);
+}
+
+//! Maior chave menor ou igual a 'chave'
+bool SPLAY_F(piso)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado) {
+    return SPLAY_F(vizinho)(T, chave, false, true, resultado);
+}
+
+//! Menor chave maior ou igual a 'chave'
+bool SPLAY_F(teto)(SPLAY_TIPO *T, SPLAY_CHAVE chave, SPLAY_CHAVE *resultado) {
+    return SPLAY_F(vizinho)(T, chave, true, true, resultado);
+}
+
+// Estrutura do iterador: pilha explícita com os ancestrais ainda não visitados
+struct SPLAY_F(iterador) {
+    SPLAY_NO **pilha; // Nós pendentes; o topo é o próximo a ser visitado
+    int topo;         // Quantidade de nós na pilha
+    int capacidade;   // Capacidade alocada da pilha
+};
+
+// Empilha o nó e todos os seus descendentes à esquerda
+static bool SPLAY_F(iterador_descer)(SPLAY_ITERADOR_TIPO *it, SPLAY_NO *no) {
+    while (no != NULL) {
+        if (it->topo == it->capacidade) { // Cresce a pilha: a árvore splay pode ser bem alta
+            int capacidade = it->capacidade ? 2 * it->capacidade : 32;
+            SPLAY_NO **pilha = (SPLAY_NO **)realloc(it->pilha, capacidade * sizeof(SPLAY_NO *));
+            if (pilha == NULL) return false;
+            it->pilha = pilha;
+            it->capacidade = capacidade;
+        }
+        it->pilha[it->topo++] = no;
+        no = no->esq;
+    }
+    return true;
+}
+
+//! Cria um iterador em ordem crescente sobre a árvore
+SPLAY_ITERADOR_TIPO *SPLAY_F(iterador_criar)(SPLAY_TIPO *T) {
+    SPLAY_ITERADOR_TIPO *it = (SPLAY_ITERADOR_TIPO *)malloc(sizeof(SPLAY_ITERADOR_TIPO));
+    if (it == NULL) {
+        fprintf(stderr, "Erro: Falha na alocação de memória.\n");
+        return NULL;
+    }
+    it->pilha = NULL;
+    it->topo = it->capacidade = 0;
+    if (T != NULL && !SPLAY_F(iterador_descer)(it, T->raiz)) {
+        SPLAY_F(iterador_apagar)(&it);
+        return NULL;
+    }
+    return it;
+}
+
+//! Retorna a próxima chave em ordem crescente
+bool SPLAY_F(iterador_proximo)(SPLAY_ITERADOR_TIPO *it, SPLAY_CHAVE *chave) {
+    if (it == NULL || it->topo == 0) return false; // Não há mais chaves
+
+    SPLAY_NO *no = it->pilha[--it->topo]; // Menor chave ainda não visitada
+    *chave = no->chave;
+    return SPLAY_F(iterador_descer)(it, no->dir); // Prepara o sucessor
+}
+
+//! Libera o iterador
+void SPLAY_F(iterador_apagar)(SPLAY_ITERADOR_TIPO **it) {
+    if (it == NULL || *it == NULL) return;
+    free((*it)->pilha);
+    free(*it);
+    *it = NULL;
+}
+
+#undef SPLAY_NO
+#endif // SPLAY_MODELO_IMPLEMENTAR
+
+#undef SPLAY_CHAVE
+#undef SPLAY_PREFIXO
+#undef SPLAY_TIPO
+#undef SPLAY_ITERADOR_TIPO
+#undef SPLAY_COMPARAR
+#undef SPLAY_INTERVALO
+#undef SPLAY_IMPRIMIR_CHAVE
+#undef SPLAY_MODELO_SEM_DECLARACOES
+#undef SPLAY_MODELO_IMPLEMENTAR
+#undef SPLAY_CONCATENAR_
+#undef SPLAY_CONCATENAR
+#undef SPLAY_F
+#undef SPLAY_MENOR
+#undef SPLAY_IGUAL
@@ -0,0 +1,120 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Conjunto.h"
+
+// Teste das operações que consomem B ("make teste_alocacoes"): ligado com
+// -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc, conta as alocações feitas durante
+// set_uniao_em_consumindo entre dois conjuntos criados com set_criar, que precisa
+// reaproveitar os nós de B sem alocar nada. Confere também o conteúdo, as invariantes e a
+// memória contabilizada em A, na união e na interseção, e o mesmo com dois alocadores do
+// usuário (com o mesmo contexto os nós mudam de dono; com contextos diferentes são
+// copiados). Imprime uma linha por caso e retorna 1 se algum falhar
+
+#define N 1000 // Elementos de cada conjunto: A tem os pares, B os múltiplos de 3
+
+void *__real_malloc(size_t tamanho);
+void *__real_calloc(size_t n, size_t tamanho);
+void *__real_realloc(void *p, size_t tamanho);
+
+static long alocacoes = 0;
+
+void *__wrap_malloc(size_t tamanho) {
+    alocacoes++;
+    return __real_malloc(tamanho);
+}
+
+void *__wrap_calloc(size_t n, size_t tamanho) {
+    alocacoes++;
+    return __real_calloc(n, tamanho);
+}
+
+void *__wrap_realloc(void *p, size_t tamanho) {
+    alocacoes++;
+    return __real_realloc(p, tamanho);
+}
+
+// Alocador do usuário que conta os bytes vivos do seu contexto
+static void *contar_alocar(size_t tamanho, void *contexto) {
+    *(size_t *)contexto += tamanho;
+    return __real_malloc(tamanho);
+}
+
+static void contar_liberar(void *p, size_t tamanho, void *contexto) {
+    *(size_t *)contexto -= tamanho;
+    free(p);
+}
+
+// Cria um conjunto com os múltiplos de 'passo' em [0, N * passo)
+static SET *criar(unsigned char tipo, const SET_ALOCADOR *alocador, int passo) {
+    SET *s = alocador ? set_criar_com_alocador(tipo, alocador) : set_criar(tipo);
+    for (int i = 0; s != NULL && i < N; i++) set_inserir(s, i * passo);
+    return s;
+}
+
+// Combina B em A consumindo B e confere o resultado; '*novas' recebe as alocações feitas
+static int testar(unsigned char tipo, const SET_ALOCADOR *alocador_a, const SET_ALOCADOR *alocador_b,
+                  bool uniao, long *novas) {
+    SET *A = criar(tipo, alocador_a, 2), *B = criar(tipo, alocador_b, 3);
+    if (A == NULL || B == NULL) return 1;
+
+    long antes = alocacoes;
+    bool ok = uniao ? set_uniao_em_consumindo(A, &B) : set_interseccao_em_consumindo(A, &B);
+    *novas = alocacoes - antes;
+
+    int falhas = !ok + (B != NULL);
+    for (int x = 0; x < 3 * N; x++) {
+        bool esperado = uniao ? (x % 2 == 0 && x < 2 * N) || x % 3 == 0 : x % 6 == 0 && x < 2 * N;
+        falhas += set_pertence(A, x) != esperado;
+    }
+    falhas += !set_auditar(A, NULL);
+
+    // A memória de A é a de um conjunto montado direto com os mesmos elementos
+    SET *C = alocador_a ? set_criar_com_alocador(tipo, alocador_a) : set_criar(tipo);
+    SET_ITERADOR *it = set_iterador_criar(A);
+    int x;
+    while (C != NULL && set_iterador_proximo(it, &x)) set_inserir(C, x);
+    set_iterador_apagar(&it);
+    falhas += C == NULL || set_memoria_usada(A) != set_memoria_usada(C);
+
+    set_apagar(&A);
+    set_apagar(&B);
+    set_apagar(&C);
+    return falhas;
+}
+
+int main(void) {
+    static const struct {
+        const char *nome;
+        unsigned char tipo;
+    } tipos[] = {{"avl", AVL_TYPE}, {"llrb", LLRB_TYPE}, {"splay", SPLAY_TYPE}};
+    size_t vivos_a = 0, vivos_b = 0;
+    SET_ALOCADOR mesmo = {contar_alocar, contar_liberar, &vivos_a};
+    SET_ALOCADOR outro = {contar_alocar, contar_liberar, &vivos_b};
+
+    int total = 0;
+    for (size_t i = 0; i < sizeof(tipos) / sizeof(tipos[0]); i++) {
+        for (int uniao = 1; uniao >= 0; uniao--) {
+            const char *op = uniao ? "uniao" : "interseccao";
+            long novas;
+
+            // Dois conjuntos de set_criar, e dois alocadores do usuário com o mesmo contexto:
+            // a união não aloca (a interseção ainda conta o resultado com um iterador)
+            int falhas = testar(tipos[i].tipo, NULL, NULL, uniao, &novas);
+            falhas += uniao && novas != 0;
+            printf("%-6s %-12s set_criar        %s (%ld alocacoes)\n", tipos[i].nome, op, falhas ? "ERRO" : "ok", novas);
+            total += falhas;
+
+            falhas = testar(tipos[i].tipo, &mesmo, &mesmo, uniao, &novas);
+            falhas += (uniao && novas != 0) || vivos_a != 0;
+            printf("%-6s %-12s mesmo contexto   %s (%ld alocacoes)\n", tipos[i].nome, op, falhas ? "ERRO" : "ok", novas);
+            total += falhas;
+
+            // Contextos diferentes: os nós de B não podem mudar de dono e a união os copia
+            falhas = testar(tipos[i].tipo, &mesmo, &outro, uniao, &novas);
+            falhas += vivos_a != 0 || vivos_b != 0;
+            printf("%-6s %-12s outro contexto   %s\n", tipos[i].nome, op, falhas ? "ERRO" : "ok");
+            total += falhas;
+        }
+    }
+    return total > 0;
+}
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Chaves.h"
+
+// Teste das instâncias de Chaves.h ("make teste_chaves"): para cada tipo de chave e cada
+// árvore, insere em ordem embaralhada as chaves de posição par de uma sequência crescente
+// escolhida para expor comparações erradas (int64 fora da faixa de 32 bits e negativos,
+// uint32 acima de INT_MAX, ID128 que diferem só na parte baixa ou com o bit alto ligado) e
+// confere pertinência, ordem do iterador, invariantes, clone e remoção, união e interseção.
+// Imprime uma linha por instância e retorna 1 se alguma falhar
+
+#define N 10000 // Posições da sequência de chaves; as pares entram na árvore
+
+static int64_t chave_i64(int i) {
+    return (int64_t)(i - N / 2) * 4000000007LL;
+}
+
+static uint32_t chave_u32(int i) {
+    return (uint32_t)i * 400000u;
+}
+
+static ID128 chave_id128(int i) {
+    ID128 c = {(uint64_t)(i / 100) * 0x028F5C28F5C28F5Cull, (uint64_t)(i % 100) * 0x0290000000000000ull + 1};
+    return c;
+}
+
+#define COMPARAR_ESCALAR(a, b) (((a) > (b)) - ((a) < (b)))
+
+// Gera a função de teste de uma instância: P é o prefixo das funções, T o tipo da árvore,
+// IT o do iterador, C o da chave, PERTENCE o nome da busca, GERAR a sequência crescente de
+// chaves e COMPARAR a comparação
+#define TESTE_CHAVES(P, T, IT, C, PERTENCE, GERAR, COMPARAR)                                 \
+    static int P##_testar(void) {                                                          \
+        int falhas = 0, elementos, profundidade;                                           \
+        T *A = P##_criar(), *impares = P##_criar();                                        \
+        if (A == NULL || impares == NULL) return 1;                                        \
+        for (int k = 0; k < N; k++) {                                                      \
+            int i = (int)((long)k * 7919 % N); /* Permutação de [0, N) */                  \
+            if (i % 2 == 0) falhas += !P##_inserir(A, GERAR(i));                           \
+            else falhas += !P##_inserir(impares, GERAR(i));                                \
+        }                                                                                  \
+        falhas += P##_inserir(A, GERAR(0)); /* Repetida */                                 \
+        for (int i = 0; i < N; i++) falhas += P##_##PERTENCE(A, GERAR(i)) != (i % 2 == 0); \
+                                                                                           \
+        IT *it = P##_iterador_criar(A);                                                    \
+        C chave;                                                                           \
+        int posicao = 0;                                                                   \
+        while (P##_iterador_proximo(it, &chave)) {                                         \
+            falhas += COMPARAR(chave, GERAR(posicao)) != 0;                                \
+            posicao += 2;                                                                  \
+        }                                                                                  \
+        P##_iterador_apagar(&it);                                                          \
+        falhas += posicao != N;                                                            \
+        falhas += P##_auditar(A, &elementos, &profundidade) + (elementos != N / 2);        \
+                                                                                           \
+        T *B = P##_clonar(A);                                                              \
+        for (int i = 0; i < N; i += 4) falhas += !P##_remover(B, GERAR(i));                \
+        for (int i = 0; i < N; i += 2) {                                                   \
+            falhas += !P##_##PERTENCE(A, GERAR(i)); /* O clone não altera A */             \
+            falhas += P##_##PERTENCE(B, GERAR(i)) != (i % 4 != 0);                         \
+        }                                                                                  \
+                                                                                           \
+        T *U = P##_uniao(B, impares), *I = P##_interseccao(A, B);                          \
+        for (int i = 0; i < N; i++) {                                                      \
+            falhas += P##_##PERTENCE(U, GERAR(i)) != (i % 4 != 0);                         \
+            falhas += P##_##PERTENCE(I, GERAR(i)) != (i % 4 == 2);                         \
+        }                                                                                  \
+        falhas += P##_auditar(U, &elementos, &profundidade) + (elementos != N - N / 4);    \
+        falhas += P##_auditar(I, &elementos, &profundidade) + (elementos != N / 4);        \
+                                                                                           \
+        P##_apagar(&A);                                                                    \
+        P##_apagar(&B);                                                                    \
+        P##_apagar(&U);                                                                    \
+        P##_apagar(&I);                                                                    \
+        P##_apagar(&impares);                                                              \
+        return falhas;                                                                     \
+    }
+
+TESTE_CHAVES(avl_i64, AVL_I64, AVL_I64_ITERADOR, int64_t, busca, chave_i64, COMPARAR_ESCALAR)
+TESTE_CHAVES(llrb_i64, LLRB_I64, LLRB_I64_ITERADOR, int64_t, pertence, chave_i64, COMPARAR_ESCALAR)
+TESTE_CHAVES(splay_i64, SPLAY_I64, SPLAY_I64_ITERADOR, int64_t, pertence, chave_i64, COMPARAR_ESCALAR)
+TESTE_CHAVES(avl_u32, AVL_U32, AVL_U32_ITERADOR, uint32_t, busca, chave_u32, COMPARAR_ESCALAR)
+TESTE_CHAVES(llrb_u32, LLRB_U32, LLRB_U32_ITERADOR, uint32_t, pertence, chave_u32, COMPARAR_ESCALAR)
+TESTE_CHAVES(splay_u32, SPLAY_U32, SPLAY_U32_ITERADOR, uint32_t, pertence, chave_u32, COMPARAR_ESCALAR)
+TESTE_CHAVES(avl_id128, AVL_ID128, AVL_ID128_ITERADOR, ID128, busca, chave_id128, id128_comparar)
+TESTE_CHAVES(llrb_id128, LLRB_ID128, LLRB_ID128_ITERADOR, ID128, pertence, chave_id128, id128_comparar)
+TESTE_CHAVES(splay_id128, SPLAY_ID128, SPLAY_ID128_ITERADOR, ID128, pertence, chave_id128, id128_comparar)
+
+int main(void) {
+    struct {
+        const char *nome;
+        int (*testar)(void);
+    } testes[] = {
+        {"avl_i64", avl_i64_testar},     {"llrb_i64", llrb_i64_testar},     {"splay_i64", splay_i64_testar},
+        {"avl_u32", avl_u32_testar},     {"llrb_u32", llrb_u32_testar},     {"splay_u32", splay_u32_testar},
+        {"avl_id128", avl_id128_testar}, {"llrb_id128", llrb_id128_testar}, {"splay_id128", splay_id128_testar},
+    };
+
+    int total = 0;
+    for (size_t i = 0; i < sizeof(testes) / sizeof(testes[0]); i++) {
+        int falhas = testes[i].testar();
+        printf("%-12s %s (%d falhas)\n", testes[i].nome, falhas == 0 ? "ok" : "ERRO", falhas);
+        total += falhas;
+    }
+    return total > 0;
+}
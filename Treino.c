@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "Conjunto.h"
+
+// Carga de treino do PGO ("make pgo"): exercita a API de conjuntos na proporção em que ela
+// costuma ser usada (muitos conjuntos pequenos, buscas em sua maioria de elementos ausentes,
+// uniões e interseções, consultas de ordem e iteração) sobre os três tipos de árvore, com
+// filtro e comprimidos. É determinística e imprime um total de conferência, que impede o
+// compilador de descartar o trabalho
+
+static unsigned int estado = 2463534242u; // Gerador xorshift32, com semente fixa
+
+static int sortear(int limite) {
+    estado ^= estado << 13;
+    estado ^= estado >> 17;
+    estado ^= estado << 5;
+    return (int)(estado % (unsigned int)limite);
+}
+
+// Muitos conjuntos pequenos, que crescem e encolhem em volta do vetor embutido
+static long treinar_pequenos(unsigned char tipo) {
+    long total = 0;
+    for (int rodada = 0; rodada < 20000; rodada++) {
+        SET *A = set_criar(tipo), *B = set_criar(tipo);
+        int tamanho = sortear(48);
+        for (int i = 0; i < tamanho; i++) {
+            set_inserir(A, sortear(100));
+            set_inserir(B, sortear(100));
+        }
+        for (int i = 0; i < 16; i++) total += set_pertence(A, sortear(100));
+        for (int i = 0; i < tamanho / 2; i++) set_remover(A, sortear(100));
+
+        SET *U = set_uniao(A, B), *I = set_interseccao(A, B);
+        int elemento;
+        if (set_minimo(U, &elemento)) total += elemento;
+        if (set_teto(I, 50, &elemento)) total += elemento;
+        set_uniao_em_consumindo(A, &B);
+        total += set_pertence(A, sortear(100));
+        set_apagar(&A);
+        set_apagar(&U);
+        set_apagar(&I);
+    }
+    return total;
+}
+
+// Um conjunto grande: carga, buscas (80% de ausentes), vizinhos, iteração e operações
+static long treinar_grandes(unsigned char tipo, bool filtro) {
+    const int n = 50000, universo = 4 * n;
+    long total = 0;
+    SET *A = filtro ? set_criar_com_filtro(tipo) : set_criar(tipo);
+    SET *B = set_criar(tipo);
+    for (int i = 0; i < n; i++) {
+        set_inserir(A, sortear(universo));
+        if (i % 4 == 0) set_inserir(B, sortear(universo));
+    }
+
+    for (int i = 0; i < 4 * n; i++) total += set_pertence(A, sortear(universo));
+    for (int i = 0; i < n / 4; i++) {
+        int resultado;
+        if (set_sucessor(A, sortear(universo), &resultado)) total += resultado & 1;
+        if (set_piso(A, sortear(universo), &resultado)) total += resultado & 1;
+    }
+
+    SET *C = set_clonar(A);
+    for (int i = 0; i < n / 8; i++) {
+        set_remover(C, sortear(universo));
+        set_inserir(C, sortear(universo));
+    }
+    SET *U = set_uniao(A, B), *I = set_interseccao(C, B);
+    set_interseccao_em(C, U);
+    set_uniao_em(B, I);
+
+    SET_ITERADOR *it = set_iterador_criar(C);
+    int elemento;
+    while (set_iterador_proximo(it, &elemento)) total += elemento & 1;
+    set_iterador_apagar(&it);
+
+    set_apagar(&A);
+    set_apagar(&B);
+    set_apagar(&C);
+    set_apagar(&U);
+    set_apagar(&I);
+    return total;
+}
+
+// Conjuntos frios: compressão, buscas e operações entre comprimidos
+static long treinar_comprimidos(void) {
+    const int n = 50000;
+    long total = 0;
+    SET *A = set_criar(AVL_TYPE), *B = set_criar(AVL_TYPE);
+    for (int i = 0; i < n; i++) {
+        set_inserir(A, sortear(8 * n));
+        set_inserir(B, sortear(8 * n));
+    }
+    set_comprimir(A);
+    set_comprimir(B);
+    for (int i = 0; i < 2 * n; i++) total += set_pertence(A, sortear(8 * n));
+
+    SET *U = set_uniao(A, B), *I = set_interseccao(A, B);
+    int elemento;
+    if (set_maximo(U, &elemento)) total += elemento & 1;
+    set_descomprimir(I, LLRB_TYPE);
+    total += set_pertence(I, sortear(8 * n));
+
+    set_apagar(&A);
+    set_apagar(&B);
+    set_apagar(&U);
+    set_apagar(&I);
+    return total;
+}
+
+int main(void) {
+    long total = 0;
+    for (unsigned char tipo = AVL_TYPE; tipo <= SPLAY_TYPE; tipo++) {
+        total += treinar_pequenos(tipo);
+        total += treinar_grandes(tipo, false);
+        total += treinar_grandes(tipo, true);
+    }
+    total += treinar_comprimidos();
+    printf("Treino concluido (conferencia %ld)\n", total);
+    return 0;
+}
@@ -1,16 +1,70 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "Conjunto.h"  
+#include "Lote.h"
+#include "Externo.h"
+
+int main(int argc, char *argv[]) {
+    // Modo em lote: "./main --lote [arquivo]" executa vários comandos sobre conjuntos nomeados
+    if (argc > 1 && strcmp(argv[1], "--lote") == 0) {
+        FILE *entrada = stdin;
+        if (argc > 2 && (entrada = fopen(argv[2], "r")) == NULL) {
+            fprintf(stderr, "Erro ao abrir o arquivo %s.\n", argv[2]);
+            return 1;
+        }
+        int erros = lote_executar(entrada, stdout);
+        if (entrada != stdin) fclose(entrada);
+        return erros > 0;
+    }
+
+    // Modo externo: "./main --externo <uniao|interseccao|diferenca> <A> <B> [memoria_MB] [avl|llrb|splay]"
+    // opera sobre arquivos maiores que a memória e escreve o resultado ordenado na saída; com um
+    // tipo, o resultado é antes carregado em bloco em um conjunto desse tipo (externo_carregar)
+    if (argc > 1 && strcmp(argv[1], "--externo") == 0) {
+        int operacao = argc > 2 ? externo_operacao(argv[2]) : -1;
+        size_t memoria = EXTERNO_MEMORIA_PADRAO;
+        int tipo = -1, megabytes;
+        char extra;
+        bool valido = operacao >= 0 && argc >= 5 && argc <= 7;
+        for (int i = 5; valido && i < argc; i++) {
+            if (strcmp(argv[i], "avl") == 0 || strcmp(argv[i], "llrb") == 0 || strcmp(argv[i], "splay") == 0) {
+                valido = tipo < 0;
+                tipo = argv[i][0] == 'a' ? AVL_TYPE : argv[i][0] == 'l' ? LLRB_TYPE : SPLAY_TYPE;
+            } else {
+                // Limite em MB: inteiro positivo, sem sinal nem sobras ("-5" ou "64k" são recusados)
+                valido = i == 5 && sscanf(argv[i], "%d%c", &megabytes, &extra) == 1 && megabytes > 0;
+                memoria = (size_t)megabytes << 20;
+            }
+        }
+        if (!valido) {
+            fprintf(stderr, "Uso: %s --externo <uniao|interseccao|diferenca> <A> <B> [memoria_MB] [avl|llrb|splay]\n",
+                    argv[0]);
+            return 1;
+        }
+        if (tipo < 0) return externo_operar(argv[3], argv[4], operacao, memoria, stdout) < 0;
+
+        SET *resultado = set_criar((unsigned char)tipo);
+        bool ok = resultado != NULL && externo_carregar(argv[3], argv[4], operacao, memoria, resultado);
+        if (ok) {
+            SET_ITERADOR *it = set_iterador_criar(resultado);
+            int elemento;
+            while (set_iterador_proximo(it, &elemento)) {
+                printf("%d\n", elemento);
+            }
+            set_iterador_apagar(&it);
+        }
+        set_apagar(&resultado);
+        return !ok;
+    }
 
-int main(void) {
     SET *conjunto_A = NULL, *conjunto_B = NULL;  // Ponteiros para os conjuntos A e B
-    unsigned char tipo;  // Tipo da estrutura de dados (0 para AVL, 1 para LLRB)
+    unsigned char tipo;  // Tipo da estrutura de dados (0 para AVL, 1 para LLRB, 2 para splay)
     int opcao;           // Código da operação escolhida pelo usuário
     int elemento;        // Elemento a ser inserido, removido ou verificado
     int n_A, n_B;        // Quantidade de elementos nos conjuntos A e B
-    SET *resultado = NULL;  // Ponteiro para armazenar o conjunto resultante das operações
 
-    // Lê o tipo de estrutura de dados (0 para AVL, 1 para LLRB)
+    // Lê o tipo de estrutura de dados (0 para AVL, 1 para LLRB, 2 para splay)
     scanf("%hhu", &tipo);
     conjunto_A = set_criar(tipo);
     conjunto_B = set_criar(tipo);
@@ -47,15 +101,15 @@ int main(void) {
             break;
 
         case 2:  // Realiza a união dos conjuntos A e B
-            resultado = set_uniao(conjunto_A, conjunto_B);  // União dos conjuntos
-            set_imprimir(resultado);  // Imprime o conjunto resultante
-            set_apagar(&resultado);  // Libera a memória do conjunto resultante
+            // Os conjuntos de entrada são descartados em seguida: A recebe o resultado
+            // reaproveitando os nós de B, sem alocar um terceiro conjunto
+            set_uniao_em_consumindo(conjunto_A, &conjunto_B);
+            set_imprimir(conjunto_A);  // Imprime o conjunto resultante
             break;
 
         case 3:  // Realiza a interseção dos conjuntos A e B
-            resultado = set_interseccao(conjunto_A, conjunto_B);  // Interseção dos conjuntos
-            set_imprimir(resultado);  // Imprime o conjunto resultante
-            set_apagar(&resultado);  // Libera a memória do conjunto resultante
+            set_interseccao_em_consumindo(conjunto_A, &conjunto_B);  // Interseção dentro de A
+            set_imprimir(conjunto_A);  // Imprime o conjunto resultante
             break;
 
         case 4:  // Remove um elemento do conjunto A